@@ -5,15 +5,26 @@
 #include <fstream>
 #include <string>
 #include <sstream>
+#include <string_view>
 #include <exception>
 #include <tuple>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <charconv>
+#include <type_traits>
+#include <thread>
+#include <algorithm>
 #include <filesystem>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/util/UtilityFile.h"
+#include "breakupModel/util/UtilityParallel.h"
 
 /**
  * Provides the functionality to read an CSV file into an container of tuples.
  * Every Type argument represents the type of a column. If the file has an header and the corresponding argument was set
  * to true in the constructor, the header can be read as strings by using getHeader().
+ * The file is memory-mapped and parsed in parallel, numbers are parsed with std::from_chars.
  *
  * @example CSVReader{int, std::string, double} reads in rows of the kind "1234,Hello World,3.33"
  *
@@ -55,95 +66,234 @@ public:
 private:
 
     /**
-     * Parses one cell of the CSV line file stream to a type V by using its >> operator.
-     * The getLine overhead fixes the problematic of ',' consumption.
-     * @tparam V - the value to be extracted, should have an >> operator overload
-     * @param istream - the line stream
+     * True for the number types which are parsed with std::from_chars (chars are read as characters by the >> operator
+     * and bool has no overload, these use the stream path).
+     */
+    template<typename V>
+    static constexpr bool isFromCharsParsable = std::is_arithmetic_v<V> && !std::is_same_v<V, bool> &&
+                                                !std::is_same_v<V, char> && !std::is_same_v<V, signed char> &&
+                                                !std::is_same_v<V, unsigned char>;
+
+    /**
+     * Parses one cell to a type V.
+     * Numbers are parsed with std::from_chars directly from the cell (a leading '+' is accepted, parsing stops at the
+     * first invalid character and an unparsable cell yields zero like the >> operator does).
+     * Every other type is parsed by using its >> operator on a stream of the cell.
+     * @tparam V - the value to be extracted, should be a number or have an >> operator overload
+     * @param cell - the content of the cell (without the separator)
      * @param value - the value extracted (non-const)
-     * @return true to not cause any issues in getTuple
      */
     template<typename V>
-    bool parseCell(std::istream &istream, V &value) const {
-        std::string cell;
-        std::getline(istream, cell, ',');
-        std::stringstream cellStream {cell};
-        cellStream.unsetf(std::ios_base::skipws);
-        cellStream >> value;
-        return true;
+    void parseCell(std::string_view cell, V &value) const {
+        if constexpr (isFromCharsParsable<V>) {
+            if (!cell.empty() && cell.front() == '+') {
+                cell.remove_prefix(1);
+            }
+            value = V{};
+            std::from_chars(cell.data(), std::next(cell.data(), cell.size()), value);
+        } else {
+            std::stringstream cellStream{std::string{cell}};
+            cellStream.unsetf(std::ios_base::skipws);
+            cellStream >> value;
+        }
     }
 
     /**
-    * Parses one cell of the CSV line file stream to a type string. Fixes the problematic of whitespace
-    * consumption with the default >> operator for strings.
-    * @param istream - the line stream
+    * Parses one cell to a type string. The cell is taken as it is (including whitespaces).
+    * @param cell - the content of the cell (without the separator)
     * @param value - the value extracted (non-const)
-    * @return true to not cause any issues in getTuple
     */
-    bool parseCell(std::istream &istream, std::string &value) const {
-        std::string cell;
-        std::getline(istream, cell, ',');
-        value = cell;
-        return true;
+    void parseCell(std::string_view cell, std::string &value) const {
+        value.assign(cell);
+    }
+
+    /**
+     * Removes the next cell from the line and returns it.
+     * @param line - the rest of the line (non-const)
+     * @return the cell or an empty cell if the line has no more cells
+     */
+    static std::string_view nextCell(std::string_view &line) {
+        const size_t separator = line.find(',');
+        const std::string_view cell = line.substr(0, separator);
+        line.remove_prefix(separator == std::string_view::npos ? line.size() : separator + 1);
+        return cell;
     }
 
     /**
-     * Creates the tuple for a given lineStream.
-     * @tparam Tuple - the tuple to be filled
+     * Creates the tuple for a given line. The cells are parsed from left to right.
      * @tparam I - index sequence (packed as long as parameter list T)
-     * @param lineStream - a CSV line/ row
-     * @param tuple the tuple to be filled
+     * @param line - a CSV line/ row
+     * @return the filled tuple
      * @related For further information about this Idea. Code is adapted from here
      * https://stackoverflow.com/questions/34314806/parsing-a-c-string-into-a-tuple [accessed 29.06.2021]
      */
-    template<typename Tuple, typename std::size_t... I>
-    void getTuple(std::istream &lineStream, Tuple &tuple, std::index_sequence<I...>) const {
-      (parseCell(lineStream, std::get<I>(tuple)), ...);
+    template<typename std::size_t... I>
+    std::tuple<T...> getTuple(std::string_view line, std::index_sequence<I...>) const {
+        std::tuple<T...> tuple{};
+        (parseCell(nextCell(line), std::get<I>(tuple)), ...);
+        return tuple;
     }
 
     /**
-     * Returns the next line of the CSV file as a tuple
-     * @tparam Tuple - the tuple to be filled
-     * @param fileStream - the CSV input stream
-     * @param tuple - the tuple to be filled
-     * @return success of parsing a new element
+     * Returns the cell with the given index of a line.
+     * @param line - a CSV line/ row
+     * @param index - the index of the cell
+     * @return the cell or an empty cell if the line has less cells
      */
-    template<typename Tuple>
-    bool nextLine(std::istream &fileStream, Tuple &tuple) const {
-        std::string line;
-        std::getline(fileStream, line);
-        if (!line.empty()) {
-            std::stringstream lineStream{line};
-            this->getTuple(lineStream, tuple, std::make_index_sequence<sizeof...(T)>{});
-            return true;
+    static std::string_view cellAt(std::string_view line, size_t index) {
+        for (size_t i = 0; i < index; ++i) {
+            nextCell(line);
         }
-        return false;
+        return nextCell(line);
+    }
+
+    /**
+     * Creates a tuple of the selected cells of a line.
+     * @tparam Columns - the indices of the selected columns
+     * @param line - a CSV line/ row
+     * @return the filled tuple
+     */
+    template<size_t... Columns>
+    std::tuple<std::tuple_element_t<Columns, std::tuple<T...>>...> getSelection(std::string_view line) const {
+        std::tuple<std::tuple_element_t<Columns, std::tuple<T...>>...> selection{};
+        std::apply([&](auto &...cells) {
+            (this->parseCell(cellAt(line, Columns), cells), ...);
+        }, selection);
+        return selection;
+    }
+
+    /**
+     * Parses the lines of the CSV file (without header). The file is memory-mapped and split into chunks of lines
+     * which are parsed in parallel. Reading stops at the first empty line. A gzip-compressed file is decompressed in
+     * blocks on a background thread while the previous block is parsed (see util::forEachTextBlock).
+     * @tparam Result - the type of the result elements
+     * @tparam ParseLine - callable (std::string_view line, std::vector<Result> &results) which parses one line into
+     * zero or more results
+     * @param parseLine - the function called for every line
+     * @return vector of results in the order of the file
+     * @throws an exception if issues are encountered during parsing
+     */
+    template<typename Result, typename ParseLine>
+    std::vector<Result> parseLines(ParseLine parseLine) const {
+        std::vector<std::vector<Result>> chunkResults{};
+        bool isFirstBlock = true;
+        //A compressed file arrives in several blocks (ending at line boundaries) which are parsed one after another
+        util::forEachTextBlock(_filepath, [](std::string_view) { return true; }, [&](std::string_view text) {
+            //Skip header if the file has a header
+            if (isFirstBlock && _hasHeader) {
+                const size_t endOfHeader = text.find('\n');
+                text.remove_prefix(endOfHeader == std::string_view::npos ? text.size() : endOfHeader + 1);
+            }
+            isFirstBlock = false;
+            //Only the lines before the first empty line are read
+            if (!text.empty() && text.front() == '\n') {
+                return false;
+            }
+            const size_t emptyLine = text.find("\n\n");
+            text = text.substr(0, emptyLine == std::string_view::npos ? text.size() : emptyLine + 1);
+
+            //Several chunks per thread for a better load balance, every line is a record
+            const size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+            const auto chunks = util::splitIntoChunks(text, 4 * hardwareThreads, [](std::string_view) { return true; });
+            std::vector<std::vector<Result>> blockResults(chunks.size());
+            //Exceptions must not leave the parallel algorithm, they are rethrown afterwards
+            std::vector<std::optional<std::string>> errors(chunks.size());
+            util::forEachIndex(chunks.size(), [&](size_t i) {
+                try {
+                    util::forEachLine(chunks[i], [&](std::string_view line) {
+                        parseLine(line, blockResults[i]);
+                    });
+                } catch (std::exception &e) {
+                    errors[i] = e.what();
+                }
+            });
+            for (size_t i = 0; i < chunks.size(); ++i) {
+                if (errors[i].has_value()) {
+                    throw std::runtime_error{errors[i].value()};
+                }
+                chunkResults.push_back(std::move(blockResults[i]));
+            }
+            return emptyLine == std::string_view::npos;
+        });
+
+        std::vector<Result> results{};
+        size_t size = 0;
+        for (const auto &chunk : chunkResults) {
+            size += chunk.size();
+        }
+        results.reserve(size);
+        for (auto &chunk : chunkResults) {
+            std::move(chunk.begin(), chunk.end(), std::back_inserter(results));
+        }
+        return results;
     }
 
 public:
 
     /**
      * Returns the lines of the CSV file in a vector. Each line is tokenized into an tuple with the corresponding types.
+     * The file is memory-mapped and split into chunks of lines which are parsed in parallel. Reading stops at the
+     * first empty line.
      * @return vector of tokenized lines
      * @throws an exception if issues are encountered during parsing
      */
     std::vector<std::tuple<T...>> getLines() const {
-        //Open fileStream stream
-        std::ifstream fileStream{_filepath};
-        std::vector<std::tuple<T...>> lines{};
-        std::tuple<T...> t;
+        return this->parseLines<std::tuple<T...>>([this](std::string_view line, auto &lines) {
+            lines.push_back(this->getTuple(line, std::make_index_sequence<sizeof...(T)>{}));
+        });
+    }
 
-        //Skip header if the fileStream has a header
-        if (_hasHeader) {
-            std::string line;
-            std::getline(fileStream, line);
-        }
+    /**
+     * Returns only the selected columns of every line, the other cells are never parsed.
+     * @tparam Columns - the indices of the selected columns
+     * @return vector of tuples with the selected cells in the order of the file
+     * @throws an exception if issues are encountered during parsing
+     */
+    template<size_t... Columns>
+    std::vector<std::tuple<std::tuple_element_t<Columns, std::tuple<T...>>...>> getColumns() const {
+        using Selection = std::tuple<std::tuple_element_t<Columns, std::tuple<T...>>...>;
+        return this->parseLines<Selection>([this](std::string_view line, auto &selections) {
+            selections.push_back(this->getSelection<Columns...>(line));
+        });
+    }
 
-        //Read row by row
-        while (this->nextLine(fileStream, t)) {
-            lines.push_back(t);
-        }
+    /**
+     * Returns only the selected columns of the lines whose cell in the key column passes the filter. The key cell is
+     * parsed first, the other cells of rejected lines are never parsed.
+     * @tparam KeyColumn - the index of the key column (e.g. the ID)
+     * @tparam Columns - the indices of the selected columns
+     * @tparam Predicate - callable (const key type &) -> bool, called concurrently
+     * @param keep - returns true for the lines to keep
+     * @return vector of tuples with the selected cells in the order of the file
+     * @throws an exception if issues are encountered during parsing
+     */
+    template<size_t KeyColumn, size_t... Columns, typename Predicate>
+    std::vector<std::tuple<std::tuple_element_t<Columns, std::tuple<T...>>...>>
+    getFilteredColumns(Predicate keep) const {
+        using Selection = std::tuple<std::tuple_element_t<Columns, std::tuple<T...>>...>;
+        return this->parseLines<Selection>([this, &keep](std::string_view line, auto &selections) {
+            std::tuple_element_t<KeyColumn, std::tuple<T...>> key{};
+            this->parseCell(cellAt(line, KeyColumn), key);
+            if (keep(key)) {
+                selections.push_back(this->getSelection<Columns...>(line));
+            }
+        });
+    }
 
-        return lines;
+    /**
+     * Returns the values of one column without parsing the other cells.
+     * @tparam Column - the index of the column
+     * @return vector of the values in the order of the file
+     * @throws an exception if issues are encountered during parsing
+     */
+    template<size_t Column>
+    std::vector<std::tuple_element_t<Column, std::tuple<T...>>> getColumn() const {
+        using V = std::tuple_element_t<Column, std::tuple<T...>>;
+        return this->parseLines<V>([this](std::string_view line, auto &values) {
+            V value{};
+            this->parseCell(cellAt(line, Column), value);
+            values.push_back(std::move(value));
+        });
     }
 
     /**
@@ -154,9 +304,12 @@ public:
     std::array<std::string, sizeof...(T)> getHeader() const {
         if (_hasHeader) {
             std::array<std::string, sizeof...(T)> header{};
-            std::ifstream fileStream{_filepath};
             std::string line;
-            std::getline(fileStream, line);
+            //Only the first block is needed (compressed files are not decompressed completely)
+            util::forEachTextBlock(_filepath, [](std::string_view) { return true; }, [&line](std::string_view text) {
+                line = std::string{text.substr(0, text.find('\n'))};
+                return false;
+            });
             std::stringstream lineStream{line};
             std::string cell;
 
@@ -0,0 +1,198 @@
+#include "CatalogSnapshot.h"
+
+void CatalogSnapshot::forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const {
+    batchSize = std::max(batchSize, size_t{1});
+    const bool restored = this->visitSnapshot([&](const Header &header, std::string_view records,
+                                                  std::string_view names) {
+        //Only one batch of Satellites is restored at a time, the records stay in the mapped file
+        const auto count = static_cast<size_t>(header.count);
+        for (size_t begin = 0; begin < count; begin += batchSize) {
+            std::vector<Satellite> batch(std::min(batchSize, count - begin));
+            util::forEachIndex(batch.size(), [&](size_t i) {
+                batch[i] = fromRecord(records.substr((begin + i) * sizeof(Record), sizeof(Record)), names);
+            });
+            visitor(batch);
+        }
+        spdlog::info("Restored {} satellites from the catalog snapshot {}", header.count, _snapshotPath);
+    });
+    if (restored) {
+        return;
+    }
+
+    //The records are compact and collected while the batches of the source are passed through
+    std::vector<Record> records{};
+    std::string names{};
+    _source->forEachSatelliteBatch(batchSize, [&](std::vector<Satellite> &batch) {
+        for (const auto &satellite : batch) {
+            records.push_back(toRecord(satellite, names));
+        }
+        visitor(batch);
+    });
+    try {
+        writeFile(_snapshotPath, this->computeKey(), records, names);
+        spdlog::info("Wrote the catalog snapshot {} with {} satellites", _snapshotPath, records.size());
+    } catch (std::exception &e) {
+        //The snapshot is only an optimization, the simulation can continue without it
+        spdlog::warn("The catalog snapshot could not be written: {}", e.what());
+    }
+}
+
+std::vector<Satellite> CatalogSnapshot::getFilteredSatelliteCollection(const std::set<size_t> &idFilter) const {
+    std::vector<Satellite> satellites{};
+    const bool restored = this->visitSnapshot([&](const Header &header, std::string_view records,
+                                                  std::string_view names) {
+        for (size_t i = 0; i < header.count; ++i) {
+            if (idFilter.count(recordID(records, i)) != 0) {
+                satellites.push_back(fromRecord(records.substr(i * sizeof(Record), sizeof(Record)), names));
+            }
+        }
+    });
+    return restored ? satellites : DataSource::getFilteredSatelliteCollection(idFilter);
+}
+
+size_t CatalogSnapshot::getMaximalID() const {
+    size_t maximalID = 0;
+    const bool restored = this->visitSnapshot([&](const Header &header, std::string_view records, std::string_view) {
+        for (size_t i = 0; i < header.count; ++i) {
+            maximalID = std::max(maximalID, recordID(records, i));
+        }
+    });
+    return restored ? maximalID : DataSource::getMaximalID();
+}
+
+std::pair<std::vector<Satellite>, size_t>
+CatalogSnapshot::getFilteredSatelliteCollectionWithMaximalID(const std::set<size_t> &idFilter) const {
+    std::vector<Satellite> satellites{};
+    size_t maximalID = 0;
+    const bool restored = this->visitSnapshot([&](const Header &header, std::string_view records,
+                                                  std::string_view names) {
+        for (size_t i = 0; i < header.count; ++i) {
+            const size_t id = recordID(records, i);
+            maximalID = std::max(maximalID, id);
+            if (idFilter.count(id) != 0) {
+                satellites.push_back(fromRecord(records.substr(i * sizeof(Record), sizeof(Record)), names));
+            }
+        }
+    });
+    return restored ? std::make_pair(std::move(satellites), maximalID)
+                    : DataSource::getFilteredSatelliteCollectionWithMaximalID(idFilter);
+}
+
+std::uint64_t CatalogSnapshot::computeKey() const {
+    std::vector<std::pair<std::uintmax_t, std::int64_t>> stamps{};
+    for (const auto &inputFile : _inputFiles) {
+        stamps.emplace_back(std::filesystem::file_size(inputFile),
+                            static_cast<std::int64_t>(std::filesystem::last_write_time(inputFile)
+                                                              .time_since_epoch().count()));
+    }
+    std::lock_guard<std::mutex> lock{_keyMutex};
+    if (_keyCache.has_value() && _keyCache->first == stamps) {
+        return _keyCache->second;
+    }
+
+    std::uint64_t key = util::fnv1a(std::string_view{MAGIC.data(), MAGIC.size()});
+    auto chain = [&key](const auto &value) {
+        key = util::fnv1a(std::string_view{reinterpret_cast<const char *>(&value), sizeof(value)}, key);
+    };
+    chain(VERSION);
+    for (size_t i = 0; i < _inputFiles.size(); ++i) {
+        const util::MappedFile file{_inputFiles[i]};
+        chain(stamps[i].first);
+        chain(stamps[i].second);
+        chain(util::hashContent(file.view()));
+    }
+    if (_propagationEpoch.has_value()) {
+        chain(_propagationEpoch->year);
+        chain(_propagationEpoch->fraction);
+    }
+    _keyCache = std::make_pair(std::move(stamps), key);
+    return key;
+}
+
+std::optional<CatalogSnapshot::Header> CatalogSnapshot::validate(std::string_view bytes, std::uint64_t key,
+                                                                 const std::string &snapshotPath) {
+    Header header{};
+    if (bytes.size() < sizeof(Header)) {
+        return std::nullopt;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION || header.recordSize != sizeof(Record) ||
+        header.key != key) {
+        return std::nullopt;
+    }
+    const std::string_view records = bytes.substr(sizeof(Header));
+    if (records.size() / sizeof(Record) < header.count ||
+        records.size() - header.count * sizeof(Record) != header.namesSize) {
+        spdlog::warn("The catalog snapshot {} is truncated and will be rewritten", snapshotPath);
+        return std::nullopt;
+    }
+    //The records must only reference the name pool and valid SatTypes, otherwise the snapshot is treated as stale
+    for (size_t i = 0; i < header.count; ++i) {
+        Record record{};
+        std::memcpy(&record, records.substr(i * sizeof(Record), sizeof(Record)).data(), sizeof(Record));
+        if (record.nameOffset > header.namesSize || record.nameLength > header.namesSize - record.nameOffset ||
+            record.satType > static_cast<std::uint8_t>(SatType::UNKNOWN)) {
+            spdlog::warn("The catalog snapshot {} is corrupt and will be rewritten", snapshotPath);
+            return std::nullopt;
+        }
+    }
+    return header;
+}
+
+Satellite CatalogSnapshot::fromRecord(std::string_view bytes, std::string_view names) {
+    Record record{};
+    std::memcpy(&record, bytes.data(), sizeof(Record));
+    Satellite satellite{record.id};
+    satellite.setName(std::string{names.substr(record.nameOffset, record.nameLength)});
+    satellite.setSatType(static_cast<SatType>(record.satType));
+    satellite.setCharacteristicLength(record.characteristicLength);
+    satellite.setAreaToMassRatio(record.areaToMassRatio);
+    satellite.setMass(record.mass);
+    satellite.setArea(record.area);
+    satellite.setEjectionVelocity(record.ejectionVelocity);
+    if (record.hasOrbitalElements != 0) {
+        const OrbitalElements elements{record.orbitalElements, Epoch{record.epochYear, record.epochFraction}};
+        satellite.setCartesianByOrbitalElements(elements, record.position, record.velocity);
+    } else {
+        satellite.setPosition(record.position);
+        satellite.setVelocity(record.velocity);
+    }
+    return satellite;
+}
+
+CatalogSnapshot::Record CatalogSnapshot::toRecord(const Satellite &satellite, std::string &names) {
+    Record record{};
+    record.id = satellite.getId();
+    record.nameOffset = names.size();
+    record.nameLength = satellite.getName().size();
+    names.append(satellite.getName());
+    record.satType = static_cast<std::uint8_t>(satellite.getSatType());
+    record.characteristicLength = satellite.getCharacteristicLength();
+    record.areaToMassRatio = satellite.getAreaToMassRatio();
+    record.mass = satellite.getMass();
+    record.area = satellite.getArea();
+    record.position = satellite.getPosition();
+    record.velocity = satellite.getVelocity();
+    record.ejectionVelocity = satellite.getEjectionVelocity();
+    //Only a cached value is saved, otherwise the Orbital Elements are derived from the state later like before
+    record.hasOrbitalElements = satellite.hasOrbitalElementsCache() ? 1 : 0;
+    if (satellite.hasOrbitalElementsCache()) {
+        const auto elements = satellite.getOrbitalElements();
+        record.orbitalElements = elements.getAsArray();
+        record.epochYear = elements.getEpoch().year;
+        record.epochFraction = elements.getEpoch().fraction;
+    }
+    return record;
+}
+
+void CatalogSnapshot::writeFile(const std::string &snapshotPath, std::uint64_t key, const std::vector<Record> &records,
+                                const std::string &names) {
+    const Header header{MAGIC, VERSION, sizeof(Record), key, records.size(), names.size()};
+
+    util::writeFileAtomically(snapshotPath, [&](std::ofstream &file) {
+        file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char *>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(Record)));
+        file.write(names.data(), static_cast<std::streamsize>(names.size()));
+    });
+}
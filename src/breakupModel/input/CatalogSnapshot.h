@@ -0,0 +1,249 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <memory>
+#include <optional>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <set>
+#include <mutex>
+#include <utility>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include "DataSource.h"
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/OrbitalElements.h"
+#include "breakupModel/util/UtilityFile.h"
+#include "breakupModel/util/UtilityParallel.h"
+#include "spdlog/spdlog.h"
+
+/**
+ * DataSource which caches the satellites of another DataSource (e.g. the joined catalog of TLESatcatDataReader) in a
+ * binary snapshot file. The snapshot is keyed by the size, modification time and content hash of the input files (and
+ * the propagation epoch). If the key matches, the snapshot is memory-mapped and the satellites are restored without
+ * parsing the inputs, otherwise the wrapped DataSource is read and a new snapshot is written.
+ * <br><br>
+ * Layout (native byte order): Header | Record[count] | names (concatenated, without separators)
+ * @note The snapshot is written to a temporary file first and then renamed, so concurrent runs never read a partial
+ * snapshot
+ */
+class CatalogSnapshot : public DataSource {
+
+public:
+
+    /**
+     * The format version, increment this if Header or Record change
+     */
+    static constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * The fixed part at the beginning of the snapshot file.
+     */
+    struct Header {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t recordSize;
+        std::uint64_t key;
+        std::uint64_t count;
+        std::uint64_t namesSize;
+    };
+
+    /**
+     * One satellite in the snapshot.
+     */
+    struct Record {
+        std::uint64_t id;
+        std::uint64_t nameOffset;
+        std::uint64_t nameLength;
+        double characteristicLength;
+        double areaToMassRatio;
+        double mass;
+        double area;
+        std::array<double, 3> position;
+        std::array<double, 3> velocity;
+        std::array<double, 3> ejectionVelocity;
+        std::array<double, 6> orbitalElements;
+        double epochFraction;
+        std::int32_t epochYear;
+        std::uint8_t satType;
+        std::uint8_t hasOrbitalElements;
+        /**
+         * Explicit (zero-initialized) padding, so that identical inputs give byte-identical snapshot files
+         */
+        std::array<std::uint8_t, 2> reserved;
+    };
+
+    static_assert(sizeof(Header) == 40, "The Header must not contain implicit padding");
+    static_assert(sizeof(Record) == 192, "The Record must not contain implicit padding");
+
+private:
+
+    static constexpr std::array<char, 8> MAGIC{'B', 'R', 'K', 'C', 'A', 'T', '\0', '\0'};
+
+    /**
+     * The path of the snapshot file
+     */
+    const std::string _snapshotPath;
+
+    /**
+     * The input files of the wrapped DataSource
+     */
+    const std::vector<std::string> _inputFiles;
+
+    /**
+     * Epoch to which the wrapped DataSource propagates (part of the key)
+     */
+    const std::optional<Epoch> _propagationEpoch;
+
+    /**
+     * The DataSource which is read if the snapshot is missing or stale
+     */
+    const std::shared_ptr<const DataSource> _source;
+
+    /**
+     * The size and modification time of each input file together with the key calculated for them, so that the
+     * content is only hashed again if one of the input files changed
+     */
+    mutable std::optional<std::pair<std::vector<std::pair<std::uintmax_t, std::int64_t>>, std::uint64_t>> _keyCache{};
+
+    mutable std::mutex _keyMutex{};
+
+public:
+
+    /**
+     * Creates a new CatalogSnapshot.
+     * @param snapshotPath - the path of the binary snapshot file
+     * @param inputFiles - the files read by the source, a change of one of them invalidates the snapshot
+     * @param propagationEpoch - the common epoch of the source (changes invalidate the snapshot, too)
+     * @param source - the wrapped DataSource
+     */
+    CatalogSnapshot(std::string snapshotPath, std::vector<std::string> inputFiles,
+                    std::optional<Epoch> propagationEpoch, std::shared_ptr<const DataSource> source)
+            : _snapshotPath{std::move(snapshotPath)},
+              _inputFiles{std::move(inputFiles)},
+              _propagationEpoch{propagationEpoch},
+              _source{std::move(source)} {}
+
+    /**
+     * Streams the satellites from the snapshot if it is up to date (restoring one batch at a time from the mapped
+     * file), otherwise streams the batches of the wrapped source and writes a new snapshot afterwards.
+     * @param batchSize - the maximal number of satellites per batch
+     * @param visitor - called for every batch
+     * @throws a runtime_error if the wrapped source throws
+     */
+    void forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const override;
+
+    /**
+     * Returns only the satellites whose ID is contained in the filter. If the snapshot is up to date, the IDs are read
+     * directly from the mapped records and only the matching satellites are restored, otherwise the wrapped source is
+     * streamed (and a new snapshot is written).
+     * @param idFilter - the IDs to keep
+     * @return SatelliteCollection containing only the filtered IDs
+     * @throws a runtime_error if the wrapped source throws
+     */
+    std::vector<Satellite> getFilteredSatelliteCollection(const std::set<size_t> &idFilter) const override;
+
+    /**
+     * Returns the maximal ID of all satellites. If the snapshot is up to date, only the IDs of the mapped records are
+     * read, otherwise the wrapped source is streamed (and a new snapshot is written).
+     * @return maximal ID or zero if the source is empty
+     * @throws a runtime_error if the wrapped source throws
+     */
+    size_t getMaximalID() const override;
+
+    /**
+     * Combines getFilteredSatelliteCollection() and getMaximalID() in one pass over the mapped records (or one pass
+     * over the wrapped source if the snapshot is not up to date).
+     * @param idFilter - the IDs to keep
+     * @return pair<SatelliteCollection containing only the filtered IDs, maximal ID or zero if the source is empty>
+     * @throws a runtime_error if the wrapped source throws
+     */
+    std::pair<std::vector<Satellite>, size_t>
+    getFilteredSatelliteCollectionWithMaximalID(const std::set<size_t> &idFilter) const override;
+
+    /**
+     * Calculates the key of the current input files. The content hash is reused as long as the size and modification
+     * time of the input files do not change.
+     * @return key
+     * @throws a runtime_error if an input file cannot be read
+     */
+    [[nodiscard]] std::uint64_t computeKey() const;
+
+private:
+
+    /**
+     * Maps the snapshot file and calls the visitor with its header, records and name pool if it is up to date.
+     * @tparam Visitor - callable (const Header &, string_view records, string_view names) -> void
+     * @param visitor - called if the snapshot is up to date
+     * @return true if the snapshot was up to date and visited
+     */
+    template<typename Visitor>
+    bool visitSnapshot(Visitor visitor) const {
+        if (!std::filesystem::exists(_snapshotPath)) {
+            return false;
+        }
+        const util::MappedFile file{_snapshotPath};
+        const auto header = validate(file.view(), this->computeKey(), _snapshotPath);
+        if (!header.has_value()) {
+            return false;
+        }
+        const std::string_view records = file.view().substr(sizeof(Header));
+        visitor(header.value(), records, records.substr(header->count * sizeof(Record)));
+        return true;
+    }
+
+    /**
+     * Reads the ID of one record without restoring it.
+     * @param records - the records of the snapshot
+     * @param index - the index of the record
+     * @return ID
+     */
+    static size_t recordID(std::string_view records, size_t index) {
+        std::uint64_t id{};
+        std::memcpy(&id, records.substr(index * sizeof(Record) + offsetof(Record, id), sizeof(id)).data(), sizeof(id));
+        return static_cast<size_t>(id);
+    }
+
+    /**
+     * Checks the header of a mapped snapshot.
+     * @param bytes - the content of the snapshot file
+     * @param key - the expected key
+     * @param snapshotPath - the snapshot file (for the warning)
+     * @return the header or nullopt if the snapshot has another version or key, is truncated or a record references
+     * names outside of the name pool or an invalid SatType
+     */
+    static std::optional<Header> validate(std::string_view bytes, std::uint64_t key, const std::string &snapshotPath);
+
+    /**
+     * Restores one satellite.
+     * @param bytes - the bytes of the Record (not necessarily aligned)
+     * @param names - the name pool of the snapshot
+     * @return Satellite
+     */
+    static Satellite fromRecord(std::string_view bytes, std::string_view names);
+
+    /**
+     * Converts one satellite into a Record.
+     * @param satellite - the Satellite
+     * @param names - the name pool to which the name is appended
+     * @return Record
+     */
+    static Record toRecord(const Satellite &satellite, std::string &names);
+
+    /**
+     * Writes the records to a snapshot file.
+     * @param snapshotPath - the snapshot file
+     * @param key - the key of the inputs
+     * @param records - the records
+     * @param names - the name pool referenced by the records
+     * @throws a runtime_error if the file cannot be written
+     */
+    static void writeFile(const std::string &snapshotPath, std::uint64_t key, const std::vector<Record> &records,
+                          const std::string &names);
+
+};
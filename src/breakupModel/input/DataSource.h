@@ -2,23 +2,139 @@
 
 #include <string>
 #include <vector>
+#include <set>
+#include <functional>
+#include <iterator>
+#include <algorithm>
+#include <utility>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Catalog.h"
+#include "breakupModel/model/OrbitalRegimeIndex.h"
 
 /**
- * Pure virtual Interface for Data Input.
- * Provides methods to get satellites from an specific input file.
+ * Interface for Data Input.
+ * Provides methods to get satellites from an specific input file. The satellites are either returned as one vector or
+ * streamed in batches of bounded size (forEachSatelliteBatch), so that consumers like catalog-wide sweeps do not need
+ * the whole catalog resident at once.
  */
 class DataSource {
 
 public:
 
+    /**
+     * Visitor which receives one batch of satellites at a time. The batch may be modified or moved from.
+     */
+    using SatelliteBatchVisitor = std::function<void(std::vector<Satellite> &batch)>;
+
+    /**
+     * The batch size used by the convenience methods which are based on forEachSatelliteBatch
+     */
+    static constexpr size_t DEFAULT_BATCH_SIZE = 4096;
+
     virtual ~DataSource() = default;
 
     /**
-     * Returns a satellite collection. Input form varies depending on subclass
+     * Streams the satellites in batches of at most batchSize satellites in the order of getSatelliteCollection().
+     * Only one batch is materialized at a time.
+     * @param batchSize - the maximal number of satellites per batch (at least one)
+     * @param visitor - called for every batch
+     */
+    virtual void forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const = 0;
+
+    /**
+     * Calls the visitor for every satellite, see forEachSatelliteBatch().
+     * @param visitor - called for every satellite
+     */
+    void forEachSatellite(const std::function<void(const Satellite &)> &visitor) const {
+        this->forEachSatelliteBatch(DEFAULT_BATCH_SIZE, [&visitor](std::vector<Satellite> &batch) {
+            std::for_each(batch.cbegin(), batch.cend(), visitor);
+        });
+    }
+
+    /**
+     * Returns a satellite collection. Input form varies depending on subclass.
+     * The default implementation collects all batches of forEachSatelliteBatch().
      * @return SatelliteCollection
      */
-    virtual std::vector<Satellite> getSatelliteCollection() const = 0;
+    virtual std::vector<Satellite> getSatelliteCollection() const {
+        std::vector<Satellite> satellites{};
+        this->forEachSatelliteBatch(DEFAULT_BATCH_SIZE, [&satellites](std::vector<Satellite> &batch) {
+            std::move(batch.begin(), batch.end(), std::back_inserter(satellites));
+        });
+        return satellites;
+    }
 
-};
+    /**
+     * Returns all objects as compact Catalog, which is much smaller than getSatelliteCollection() for large sources.
+     * The default implementation appends the streamed batches (cartesian state).
+     * @return Catalog
+     */
+    virtual Catalog getCatalog() const {
+        Catalog catalog{};
+        this->forEachSatelliteBatch(DEFAULT_BATCH_SIZE, [&catalog](std::vector<Satellite> &batch) {
+            catalog.append(batch);
+        });
+        return catalog;
+    }
+
+    /**
+     * Returns a range index over the orbital regime of all objects, built from getCatalog().
+     * Use OrbitalRegimeIndex::findIDs() to select objects e.g. for getFilteredSatelliteCollection().
+     * @return OrbitalRegimeIndex
+     */
+    OrbitalRegimeIndex getOrbitalRegimeIndex() const {
+        return OrbitalRegimeIndex{this->getCatalog()};
+    }
+
+    /**
+     * Returns only the satellites whose ID is contained in the filter.
+     * Subclasses which can skip the records of other IDs before parsing and converting them should override this,
+     * the default implementation filters the streamed batches.
+     * @param idFilter - the IDs to keep
+     * @return SatelliteCollection containing only the filtered IDs
+     */
+    virtual std::vector<Satellite> getFilteredSatelliteCollection(const std::set<size_t> &idFilter) const {
+        std::vector<Satellite> satellites{};
+        this->forEachSatelliteBatch(DEFAULT_BATCH_SIZE, [&](std::vector<Satellite> &batch) {
+            std::copy_if(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()),
+                         std::back_inserter(satellites),
+                         [&](const Satellite &sat) { return idFilter.count(sat.getId()) != 0; });
+        });
+        return satellites;
+    }
 
+    /**
+     * Returns the maximal ID of all satellites of this source (not only of filtered ones).
+     * The default implementation streams all satellites.
+     * @return maximal ID or zero if the source is empty
+     */
+    virtual size_t getMaximalID() const {
+        size_t maximalID = 0;
+        this->forEachSatellite([&maximalID](const Satellite &sat) {
+            maximalID = std::max(maximalID, sat.getId());
+        });
+        return maximalID;
+    }
+
+    /**
+     * Returns the satellites whose ID is contained in the filter together with the maximal ID of all satellites, like
+     * getFilteredSatelliteCollection() and getMaximalID() but the default implementation streams the source only once.
+     * @param idFilter - the IDs to keep
+     * @return pair<SatelliteCollection containing only the filtered IDs, maximal ID or zero if the source is empty>
+     */
+    virtual std::pair<std::vector<Satellite>, size_t>
+    getFilteredSatelliteCollectionWithMaximalID(const std::set<size_t> &idFilter) const {
+        std::vector<Satellite> satellites{};
+        size_t maximalID = 0;
+        this->forEachSatelliteBatch(DEFAULT_BATCH_SIZE, [&](std::vector<Satellite> &batch) {
+            for (auto &sat : batch) {
+                maximalID = std::max(maximalID, sat.getId());
+                if (idFilter.count(sat.getId()) != 0) {
+                    satellites.push_back(std::move(sat));
+                }
+            }
+        });
+        return std::make_pair(std::move(satellites), maximalID);
+    }
+
+};
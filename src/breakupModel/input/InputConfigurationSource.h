@@ -89,4 +89,23 @@ public:
      */
     virtual bool getEnforceMassConservation() const = 0;
 
+    /**
+     * Returns the common epoch to which all input satellites given as TLE should be propagated before the breakup.
+     * Default implemented: No propagation, every satellite keeps the epoch of its TLE
+     * @return optional containing the epoch or not
+     */
+    virtual std::optional<Epoch> getPropagationEpoch() const {
+        return std::nullopt;
+    }
+
+    /**
+     * Returns the minimal perigee altitude in [m] of the fragments. Fragments with a lower perigee (reentry) and
+     * fragments on hyperbolic trajectories (escape) are removed from the result after the breakup.
+     * Default implemented: No culling, every fragment is kept
+     * @return optional containing the altitude or not
+     */
+    virtual std::optional<double> getCullingAltitude() const {
+        return std::nullopt;
+    }
+
 };
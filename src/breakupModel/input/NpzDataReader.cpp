@@ -0,0 +1,106 @@
+#include "NpzDataReader.h"
+
+void NpzDataReader::forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const {
+    const Columns columns = this->readColumns();
+    batchSize = std::max(batchSize, size_t{1});
+    for (size_t begin = 0; begin < columns.id.size(); begin += batchSize) {
+        auto batch = createBatch(columns, begin, std::min(batchSize, columns.id.size() - begin));
+        visitor(batch);
+    }
+}
+
+NpzDataReader::Columns NpzDataReader::readColumns() const {
+    const util::MappedFile file{_filename};
+    std::deque<std::string> inflatedEntries{};
+    const auto arrays = util::parseNpz(file.view(), inflatedEntries);
+
+    Columns columns{};
+    const auto idEntry = arrays.find(ID_ARRAY);
+    if (idEntry == arrays.end()) {
+        throw std::runtime_error{"The NPZ file " + _filename + " does not contain the array " + ID_ARRAY + "!"};
+    }
+    const auto idArray = util::parseNpy(idEntry->second);
+    if (idArray.shape.size() != 1) {
+        throw std::runtime_error{"The array " + std::string{ID_ARRAY} + " of the NPZ file " + _filename +
+                                 " must be one-dimensional!"};
+    }
+    const size_t count = idArray.shape[0];
+    columns.id = idArray.toVector<size_t>();
+
+    if (const auto satType = this->readArray(arrays, SATELLITE_TYPE_ARRAY, {count})) {
+        const auto codes = satType->toVector<int>();
+        columns.satType.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (codes[i] < 0 || codes[i] > static_cast<int>(SatType::UNKNOWN)) {
+                throw std::runtime_error{"The satellite type " + std::to_string(codes[i]) + " in the NPZ file " +
+                                         _filename + " is no valid SatType!"};
+            }
+            columns.satType[i] = static_cast<SatType>(codes[i]);
+        }
+    }
+    if (const auto mass = this->readArray(arrays, MASS_ARRAY, {count})) {
+        columns.mass = mass->toVector<double>();
+    }
+    if (const auto area = this->readArray(arrays, AREA_ARRAY, {count})) {
+        columns.area = area->toVector<double>();
+    }
+    columns.position = this->readRows<3>(arrays, POSITION_ARRAY, count);
+    columns.velocity = this->readRows<3>(arrays, VELOCITY_ARRAY, count);
+    columns.kepler = this->readRows<6>(arrays, KEPLER_ARRAY, count);
+    return columns;
+}
+
+std::vector<Satellite> NpzDataReader::createBatch(const Columns &columns, size_t begin, size_t size) {
+    //The Kepler elements of the batch are converted to the cartesian state at once
+    util::ColumnVector<std::array<double, 3>> position{};
+    util::ColumnVector<std::array<double, 3>> velocity{};
+    std::vector<OrbitalElements> orbitalElements{};
+    if (!columns.kepler.empty()) {
+        orbitalElements.resize(size);
+        util::forEachIndex(size, [&](size_t i) { orbitalElements[i] = OrbitalElements{columns.kepler[begin + i]}; });
+        std::tie(position, velocity) = OrbitalElementsColumns::fromAoS(orbitalElements).toCartesian();
+    }
+
+    std::vector<Satellite> satellites(size);
+    util::forEachIndex(size, [&](size_t i) {
+        const size_t index = begin + i;
+        SatelliteBuilder satelliteBuilder{};
+        satelliteBuilder.setID(columns.id[index]);
+        if (!columns.satType.empty()) {
+            satelliteBuilder.setSatType(columns.satType[index]);
+        }
+        if (!columns.mass.empty()) {
+            satelliteBuilder.setMass(columns.mass[index]);
+        }
+        if (!columns.area.empty()) {
+            satelliteBuilder.setMassByArea(columns.area[index]);
+        }
+        if (!columns.velocity.empty()) {
+            satelliteBuilder.setVelocity(columns.velocity[index]);
+        }
+        if (!columns.position.empty()) {
+            satelliteBuilder.setPosition(columns.position[index]);
+        }
+        if (!columns.kepler.empty()) {
+            satelliteBuilder.setOrbitalElements(orbitalElements[i], position[i], velocity[i]);
+        }
+        satellites[i] = satelliteBuilder.getResult();
+    });
+    return satellites;
+}
+
+std::optional<util::NpyArray> NpzDataReader::readArray(const std::map<std::string, std::string_view> &arrays,
+                                                       const std::string &name,
+                                                       const std::vector<size_t> &shape) const {
+    const auto entry = arrays.find(name);
+    if (entry == arrays.end()) {
+        return std::nullopt;
+    }
+    auto array = util::parseNpy(entry->second);
+    if (array.shape != shape) {
+        throw std::runtime_error{"The array " + name + " of the NPZ file " + _filename +
+                                 " does not have the expected shape (number of satellites, " +
+                                 std::to_string(shape.size() > 1 ? shape[1] : 1) + ")!"};
+    }
+    return array;
+}
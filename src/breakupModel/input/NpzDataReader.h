@@ -0,0 +1,133 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <map>
+#include <deque>
+#include <optional>
+#include <algorithm>
+#include <filesystem>
+#include "DataSource.h"
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/SatelliteBuilder.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityFile.h"
+#include "breakupModel/util/UtilityNpy.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * Reads Satellites from a NumPy .npz archive (written by numpy.savez or, if built with zlib, numpy.savez_compressed)
+ * with one array per attribute. This is the bulk alternative to the YAMLDataReader: The archive is memory-mapped, every
+ * array is converted at once and the satellites are constructed in parallel.
+ * <br><br>
+ * The arrays (n is the number of satellites, all arrays but "id" are optional):
+ * - id (n): the IDs
+ * - satType (n): the SatType as integer (0 SPACECRAFT, 1 ROCKET_BODY, 2 DEBRIS, 3 UNKNOWN)
+ * - mass (n): the mass [kg]
+ * - area (n): the area [m^2] from which the mass is derived (like "area" in the YAML input)
+ * - position (n, 3), velocity (n, 3): the cartesian state [m], [m/s]
+ * - kepler (n, 6): a [m], e, i, W, w, EA [rad] (the order of OrbitalElements), replaces position and velocity
+ */
+class NpzDataReader : public DataSource {
+
+    static constexpr char ID_ARRAY[] = "id";
+    static constexpr char SATELLITE_TYPE_ARRAY[] = "satType";
+    static constexpr char MASS_ARRAY[] = "mass";
+    static constexpr char AREA_ARRAY[] = "area";
+    static constexpr char POSITION_ARRAY[] = "position";
+    static constexpr char VELOCITY_ARRAY[] = "velocity";
+    static constexpr char KEPLER_ARRAY[] = "kepler";
+
+    /**
+     * The attributes of all satellites, the optional ones are empty if not given.
+     */
+    struct Columns {
+        std::vector<size_t> id{};
+        std::vector<SatType> satType{};
+        std::vector<double> mass{};
+        std::vector<double> area{};
+        std::vector<std::array<double, 3>> position{};
+        std::vector<std::array<double, 3>> velocity{};
+        std::vector<std::array<double, 6>> kepler{};
+    };
+
+    const std::string _filename;
+
+public:
+
+    /**
+     * Creates a new NPZ Data Reader.
+     * @param filename - the .npz archive
+     * @throws a runtime_error if the file does not exist
+     */
+    explicit NpzDataReader(std::string filename)
+            : _filename{std::move(filename)} {
+        if (!std::filesystem::exists(_filename)) {
+            throw std::runtime_error{"The NPZ file " + _filename + " does not exist!"};
+        }
+    }
+
+    /**
+     * Streams the satellites of the archive in the order of the arrays.
+     * @param batchSize - the maximal number of satellites per batch
+     * @param visitor - called for every batch
+     * @throws a runtime_error if the archive or one of the arrays is malformed
+     */
+    void forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const override;
+
+private:
+
+    /**
+     * Reads and converts all arrays of the archive.
+     * @return Columns
+     * @throws a runtime_error if an array is missing or malformed or the arrays have different lengths
+     */
+    Columns readColumns() const;
+
+    /**
+     * Creates the satellites of a range of the columns.
+     * @param columns - the attributes of all satellites
+     * @param begin - the first satellite of the batch
+     * @param size - the number of satellites of the batch
+     * @return the satellites
+     */
+    static std::vector<Satellite> createBatch(const Columns &columns, size_t begin, size_t size);
+
+    /**
+     * Reads an optional array of the shape (n, N) into rows.
+     * @tparam N - the number of columns
+     * @param arrays - the arrays of the archive
+     * @param name - the name of the array
+     * @param count - the number of satellites n
+     * @return the rows or an empty vector if the array is not contained
+     * @throws a runtime_error if the array has another shape
+     */
+    template<size_t N>
+    std::vector<std::array<double, N>> readRows(const std::map<std::string, std::string_view> &arrays,
+                                                const std::string &name, size_t count) const {
+        const auto array = this->readArray(arrays, name, {count, N});
+        std::vector<std::array<double, N>> rows{};
+        if (array.has_value()) {
+            const auto values = array->template toVector<double>();
+            rows.resize(count);
+            util::forEachIndex(count, [&](size_t i) {
+                std::copy_n(std::next(values.cbegin(), static_cast<std::ptrdiff_t>(i * N)), N, rows[i].begin());
+            });
+        }
+        return rows;
+    }
+
+    /**
+     * Parses an optional array and checks its shape.
+     * @param arrays - the arrays of the archive
+     * @param name - the name of the array
+     * @param shape - the expected shape
+     * @return the array or nullopt if not contained
+     * @throws a runtime_error if the array has another shape
+     */
+    std::optional<util::NpyArray> readArray(const std::map<std::string, std::string_view> &arrays,
+                                            const std::string &name, const std::vector<size_t> &shape) const;
+
+};
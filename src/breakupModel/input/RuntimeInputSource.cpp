@@ -25,6 +25,15 @@ std::vector<Satellite> RuntimeInputSource::getSatelliteCollection() const {
     return _satellites;
 }
 
+void RuntimeInputSource::forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const {
+    batchSize = std::max(batchSize, size_t{1});
+    for (size_t begin = 0; begin < _satellites.size(); begin += batchSize) {
+        const size_t end = std::min(begin + batchSize, _satellites.size());
+        std::vector<Satellite> batch(std::next(_satellites.begin(), begin), std::next(_satellites.begin(), end));
+        visitor(batch);
+    }
+}
+
 bool RuntimeInputSource::getEnforceMassConservation() const {
     return _enforceMassConservation;
 }
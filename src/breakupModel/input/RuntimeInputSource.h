@@ -109,5 +109,12 @@ public:
 
     std::vector<Satellite> getSatelliteCollection() const final;
 
+    /**
+     * Streams copies of the satellites in batches.
+     * @param batchSize - the maximal number of satellites per batch
+     * @param visitor - called for every batch
+     */
+    void forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const final;
+
     bool getEnforceMassConservation() const final;
 };
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "TLEHistory.h"
+
+TLEHistory::TLEHistory(const TLEColumns &tle) {
+    const size_t size = tle.size();
+    std::vector<double> julianDates(size);
+    util::forEachIndex(size, [&](size_t i) { julianDates[i] = tle.epoch[i].toJulianDate(); });
+
+    //Sort the entries by ID and epoch, the position in the file keeps the order of equal epochs deterministic
+    std::vector<size_t> order(size);
+    util::forEachIndex(size, [&](size_t i) { order[i] = i; });
+    std::sort(std::execution::par_unseq, order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return std::tie(tle.id[lhs], julianDates[lhs], lhs) < std::tie(tle.id[rhs], julianDates[rhs], rhs);
+    });
+
+    _julianDates.resize(size);
+    _elements.resize(size);
+    _epochYears.resize(size);
+    _epochFractions.resize(size);
+    _bstar.resize(size);
+    util::forEachIndex(size, [&](size_t i) {
+        const size_t entry = order[i];
+        _julianDates[i] = julianDates[entry];
+        _elements[i] = tle.orbitalElements.getElement(entry).getAsArray();
+        _epochYears[i] = tle.epoch[entry].year;
+        _epochFractions[i] = tle.epoch[entry].fraction;
+        _bstar[i] = tle.bstar[entry];
+    });
+
+    //The group boundaries
+    _offsets.clear();
+    for (size_t i = 0; i < size; ++i) {
+        if (i == 0 || tle.id[order[i]] != tle.id[order[i - 1]]) {
+            _ids.push_back(tle.id[order[i]]);
+            _offsets.push_back(i);
+        }
+    }
+    _offsets.push_back(size);
+    this->buildIndex();
+}
+
+std::vector<TLEEntry> TLEHistory::getEntries(size_t id) const {
+    std::vector<TLEEntry> entries{};
+    const size_t group = _index.find(id);
+    if (group != util::IdIndex::NOT_FOUND) {
+        for (size_t i = _offsets[group]; i < _offsets[group + 1]; ++i) {
+            entries.push_back(this->getEntry(i));
+        }
+    }
+    return entries;
+}
+
+std::optional<TLEEntry> TLEHistory::getClosestEntry(size_t id, const Epoch &epoch) const {
+    const size_t group = _index.find(id);
+    if (group == util::IdIndex::NOT_FOUND) {
+        return std::nullopt;
+    }
+    return this->getEntry(this->findClosest(_offsets[group], _offsets[group + 1], epoch.toJulianDate()));
+}
+
+TLEColumns TLEHistory::getClosestColumns(const Epoch &epoch) const {
+    const double julianDate = epoch.toJulianDate();
+    std::vector<OrbitalElements> elements(_ids.size());
+    TLEColumns columns{};
+    columns.id.resize(_ids.size());
+    columns.epoch.resize(_ids.size());
+    columns.bstar.resize(_ids.size());
+    util::forEachIndex(_ids.size(), [&](size_t group) {
+        const size_t position = this->findClosest(_offsets[group], _offsets[group + 1], julianDate);
+        const TLEEntry entry = this->getEntry(position);
+        columns.id[group] = _ids[group];
+        columns.epoch[group] = entry.orbitalElements.getEpoch();
+        columns.bstar[group] = entry.bstar;
+        elements[group] = entry.orbitalElements;
+    });
+    columns.orbitalElements = OrbitalElementsColumns::fromAoS(elements);
+    return columns;
+}
+
+void TLEHistory::save(const std::string &path) const {
+    const Header header{MAGIC, VERSION, 0, _ids.size(), _julianDates.size()};
+
+    util::writeFileAtomically(path, [&](std::ofstream &file) {
+        auto writeColumn = [&file](const auto &column) {
+            using Value = typename std::decay_t<decltype(column)>::value_type;
+            file.write(reinterpret_cast<const char *>(column.data()),
+                       static_cast<std::streamsize>(column.size() * sizeof(Value)));
+        };
+        file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+        writeColumn(_ids);
+        writeColumn(_offsets);
+        writeColumn(_julianDates);
+        writeColumn(_elements);
+        writeColumn(_epochYears);
+        writeColumn(_epochFractions);
+        writeColumn(_bstar);
+    });
+}
+
+TLEHistory TLEHistory::load(const std::string &path) {
+    if (!std::filesystem::exists(path)) {
+        throw std::runtime_error{"The TLE history file " + path + " does not exist!"};
+    }
+    const util::MappedFile file{path};
+    std::string_view bytes = file.view();
+
+    Header header{};
+    if (bytes.size() < sizeof(Header)) {
+        throw std::runtime_error{"The TLE history file " + path + " is truncated!"};
+    }
+    std::memcpy(&header, bytes.data(), sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION) {
+        throw std::runtime_error{"The file " + path + " is no TLE history of version " + std::to_string(VERSION)};
+    }
+    bytes.remove_prefix(sizeof(Header));
+
+    TLEHistory history{};
+    auto readColumn = [&](auto &column, std::uint64_t count) {
+        using Value = typename std::decay_t<decltype(column)>::value_type;
+        if (bytes.size() / sizeof(Value) < count) {
+            throw std::runtime_error{"The TLE history file " + path + " is truncated!"};
+        }
+        column.resize(count);
+        std::memcpy(column.data(), bytes.data(), count * sizeof(Value));
+        bytes.remove_prefix(count * sizeof(Value));
+    };
+    readColumn(history._ids, header.idCount);
+    readColumn(history._offsets, header.idCount + 1);
+    readColumn(history._julianDates, header.entryCount);
+    readColumn(history._elements, header.entryCount);
+    readColumn(history._epochYears, header.entryCount);
+    readColumn(history._epochFractions, header.entryCount);
+    readColumn(history._bstar, header.entryCount);
+    //The entries of ID i are [offsets[i], offsets[i + 1]), so the offsets must cover exactly all entries in order
+    //without an empty group, and the IDs must be strictly ascending for the binary search
+    auto isStrictlyAscending = [](const auto &column) {
+        return std::adjacent_find(column.cbegin(), column.cend(), std::greater_equal<>{}) == column.cend();
+    };
+    if (history._offsets.front() != 0 || history._offsets.back() != header.entryCount ||
+        !isStrictlyAscending(history._offsets) || !isStrictlyAscending(history._ids)) {
+        throw std::runtime_error{"The TLE history file " + path + " is corrupt!"};
+    }
+    history.buildIndex();
+    return history;
+}
+
+size_t TLEHistory::findClosest(size_t begin, size_t end, double julianDate) const {
+    const auto first = std::next(_julianDates.cbegin(), static_cast<std::ptrdiff_t>(begin));
+    const auto last = std::next(_julianDates.cbegin(), static_cast<std::ptrdiff_t>(end));
+    const auto later = std::lower_bound(first, last, julianDate);
+    if (later == first) {
+        return begin;
+    }
+    const auto earlier = std::prev(later);
+    if (later == last || julianDate - *earlier <= *later - julianDate) {
+        return static_cast<size_t>(std::distance(_julianDates.cbegin(), earlier));
+    }
+    return static_cast<size_t>(std::distance(_julianDates.cbegin(), later));
+}
+
+TLEEntry TLEHistory::getEntry(size_t position) const {
+    return TLEEntry{OrbitalElements{_elements[position], Epoch{_epochYears[position], _epochFractions[position]}},
+                    _bstar[position]};
+}
+
+void TLEHistory::buildIndex() {
+    _index = util::IdIndex::build(_ids.size(), [this](size_t i) { return static_cast<size_t>(_ids[i]); });
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <optional>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <functional>
+#include <execution>
+#include "TLEReader.h"
+#include "breakupModel/model/OrbitalElements.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityFile.h"
+#include "breakupModel/util/UtilityHashIndex.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * Index over all element sets of a TLE file (e.g. a historical TLE archive with many entries per object).
+ * The entries are grouped by satellite ID and sorted by their epoch inside each group (CSR layout: one offset per ID
+ * into flat columns). The group of an ID is found with a hash index, the element set closest to a given time with a
+ * binary search over the Julian Dates of the group, so a lookup costs O(log n) in the number of entries of this ID.
+ * <br><br>
+ * The index can be saved to a binary file and loaded again without parsing the TLE file.
+ * Layout (native byte order): Header | ids[idCount] | offsets[idCount + 1] | julianDates[entryCount] |
+ * elements[entryCount] | epochYears[entryCount] | epochFractions[entryCount] | bstar[entryCount]
+ */
+class TLEHistory {
+
+    /**
+     * The format version, increment this if the layout changes
+     */
+    static constexpr std::uint32_t VERSION = 1;
+
+    static constexpr std::array<char, 8> MAGIC{'B', 'R', 'K', 'T', 'L', 'E', 'H', '\0'};
+
+    /**
+     * The fixed part at the beginning of the index file.
+     */
+    struct Header {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t reserved;
+        std::uint64_t idCount;
+        std::uint64_t entryCount;
+    };
+
+    /**
+     * The distinct IDs in ascending order
+     */
+    std::vector<std::uint64_t> _ids{};
+
+    /**
+     * The entries of _ids[i] are [_offsets[i], _offsets[i + 1])
+     */
+    std::vector<std::uint64_t> _offsets{0};
+
+    /**
+     * The epoch of each entry as Julian Date (the sort key inside a group)
+     */
+    std::vector<double> _julianDates{};
+
+    /**
+     * The Orbital Elements of each entry (see OrbitalElements::getAsArray())
+     */
+    std::vector<std::array<double, 6>> _elements{};
+
+    /**
+     * The epoch year of each entry
+     */
+    std::vector<std::int32_t> _epochYears{};
+
+    /**
+     * The epoch day + fraction of the day of each entry
+     */
+    std::vector<double> _epochFractions{};
+
+    /**
+     * The drag term B* of each entry in [1/earth radii]
+     */
+    std::vector<double> _bstar{};
+
+    /**
+     * Maps an ID to its position in _ids
+     */
+    util::IdIndex _index{};
+
+public:
+
+    /**
+     * Creates an empty history.
+     */
+    TLEHistory() = default;
+
+    /**
+     * Builds the history from all entries of a TLE file. Entries with the same ID and epoch keep their order of the
+     * file.
+     * @param tle - the entries of a TLE file, e.g. TLEReader::getTLEColumns()
+     */
+    explicit TLEHistory(const TLEColumns &tle);
+
+    /**
+     * Returns the number of distinct IDs.
+     * @return number of IDs
+     */
+    [[nodiscard]] size_t getIDCount() const {
+        return _ids.size();
+    }
+
+    /**
+     * Returns the number of element sets.
+     * @return number of entries
+     */
+    [[nodiscard]] size_t size() const {
+        return _julianDates.size();
+    }
+
+    /**
+     * Returns true if the history contains at least one element set of the ID.
+     * @param id - the satellite ID
+     * @return true if contained
+     */
+    [[nodiscard]] bool contains(size_t id) const {
+        return _index.contains(id);
+    }
+
+    /**
+     * Returns all element sets of one ID sorted by epoch.
+     * @param id - the satellite ID
+     * @return the entries (empty if the ID is not contained)
+     */
+    [[nodiscard]] std::vector<TLEEntry> getEntries(size_t id) const;
+
+    /**
+     * Returns the element set of an ID whose epoch is closest to the given epoch (the earlier one on a tie).
+     * @param id - the satellite ID
+     * @param epoch - the point in time
+     * @return the entry or nullopt if the ID is not contained
+     */
+    [[nodiscard]] std::optional<TLEEntry> getClosestEntry(size_t id, const Epoch &epoch) const;
+
+    /**
+     * Returns one element set per ID, the one closest to the given epoch, as TLEColumns (in ascending order of the
+     * IDs). This is the input for the join of TLESatcatDataReader if the whole catalog is wanted at one point in time.
+     * @param epoch - the point in time
+     * @return TLEColumns with one entry per ID
+     */
+    [[nodiscard]] TLEColumns getClosestColumns(const Epoch &epoch) const;
+
+    /**
+     * Saves the index to a binary file (written to a temporary file first, then renamed).
+     * @param path - the index file
+     * @throws a runtime_error if the file cannot be written
+     */
+    void save(const std::string &path) const;
+
+    /**
+     * Loads an index saved with save().
+     * @param path - the index file
+     * @return TLEHistory
+     * @throws a runtime_error if the file does not exist, has another version or is truncated
+     */
+    static TLEHistory load(const std::string &path);
+
+private:
+
+    /**
+     * Returns the position of the entry of the group [begin, end) which is closest to the Julian Date.
+     * @param begin - the first entry of the group
+     * @param end - one behind the last entry of the group
+     * @param julianDate - the point in time
+     * @return position of the entry
+     */
+    [[nodiscard]] size_t findClosest(size_t begin, size_t end, double julianDate) const;
+
+    /**
+     * Returns the entry at a position.
+     * @param position - the position in the flat columns
+     * @return TLEEntry
+     */
+    [[nodiscard]] TLEEntry getEntry(size_t position) const;
+
+    /**
+     * Rebuilds the hash index over _ids.
+     */
+    void buildIndex();
+
+};
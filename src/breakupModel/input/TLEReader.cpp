@@ -1,108 +1,211 @@
 #include "TLEReader.h"
 
-const std::map<char, size_t> TLEReader::alpha5NumberingSchemeOffset{
-        {' ', 0},
-        {'0', 0},
-        {'1', 10000},
-        {'2', 20000},
-        {'3', 30000},
-        {'4', 40000},
-        {'5', 50000},
-        {'6', 60000},
-        {'7', 70000},
-        {'8', 80000},
-        {'9', 90000},
-        {'A', 100000},
-        {'B', 110000},
-        {'C', 120000},
-        {'D', 130000},
-        {'E', 140000},
-        {'F', 150000},
-        {'G', 160000},
-        {'H', 170000},
-        {'J', 180000},
-        {'K', 190000},
-        {'L', 200000},
-        {'M', 210000},
-        {'N', 220000},
-        {'P', 230000},
-        {'Q', 240000},
-        {'R', 250000},
-        {'S', 260000},
-        {'T', 270000},
-        {'U', 280000},
-        {'V', 290000},
-        {'W', 300000},
-        {'X', 310000},
-        {'Y', 320000},
-        {'Z', 330000}
-};
+const std::array<size_t, 128> TLEReader::alpha5NumberingSchemeOffset = [] {
+    std::array<size_t, 128> offset{};
+    offset.fill(INVALID_ALPHA5);
+    offset[' '] = 0;
+    offset['0'] = 0;
+    for (char digit = '1'; digit <= '9'; ++digit) {
+        offset[static_cast<size_t>(digit)] = static_cast<size_t>(digit - '0') * 10000;
+    }
+    size_t value = 100000;
+    for (char letter = 'A'; letter <= 'Z'; ++letter) {
+        if (letter != 'I' && letter != 'O') {
+            offset[static_cast<size_t>(letter)] = value;
+            value += 10000;
+        }
+    }
+    return offset;
+}();
 
 std::map<size_t, OrbitalElements> TLEReader::getMappingIDOrbitalElements() const {
     std::map<size_t, OrbitalElements> mapping{};
+    for (auto &[id, entry] : getMappingIDTLEEntries()) {
+        mapping.emplace_hint(mapping.end(), id, entry.orbitalElements);
+    }
+    return mapping;
+}
+
+std::map<size_t, TLEEntry> TLEReader::getMappingIDTLEEntries() const {
+    std::map<size_t, TLEEntry> mapping{};
+    const auto columns = getTLEColumns();
+    //The first entry of an ID in the file is the one kept
+    for (size_t i = 0; i < columns.size(); ++i) {
+        if (mapping.count(columns.id[i]) == 0) {
+            mapping.emplace(columns.id[i], columns.getEntry(i));
+        }
+    }
+    return mapping;
+}
 
-    std::ifstream fileStream{_filepath};
-    std::string line;
-    std::string line1;
-    std::string line2;
+TLEColumns TLEReader::getTLEColumns(const IDFilter &idFilter) const {
+    auto rawChunks = parseFile(idFilter, false);
+    size_t size = 0;
+    for (const auto &rawChunk : rawChunks) {
+        size += rawChunk.ids.size();
+    }
 
-    bool line1Found = false;
+    //Concatenate the chunks in the order of the file
+    TLEColumns columns{};
+    std::vector<std::array<double, 6>> tleData{};
+    columns.id.reserve(size);
+    columns.epoch.reserve(size);
+    columns.bstar.reserve(size);
+    tleData.reserve(size);
+    for (auto &rawChunk : rawChunks) {
+        columns.id.insert(columns.id.end(), rawChunk.ids.begin(), rawChunk.ids.end());
+        columns.epoch.insert(columns.epoch.end(), rawChunk.epochs.begin(), rawChunk.epochs.end());
+        columns.bstar.insert(columns.bstar.end(), rawChunk.bstar.begin(), rawChunk.bstar.end());
+        tleData.insert(tleData.end(), rawChunk.tleData.begin(), rawChunk.tleData.end());
+    }
+
+    //The anomaly conversion is done for all entries at once and in parallel
+    const OrbitalElementsFactory factory{};
+    columns.orbitalElements.resize(size);
+    util::forEachIndex(size, [&](size_t i) {
+        columns.orbitalElements.setElement(i, factory.createFromTLEData(tleData[i], columns.epoch[i]).getAsArray());
+    });
+    return columns;
+}
+
+std::vector<size_t> TLEReader::getIDs() const {
+    auto rawChunks = parseFile(nullptr, true);
+    std::vector<size_t> ids{};
+    for (auto &rawChunk : rawChunks) {
+        ids.insert(ids.end(), rawChunk.ids.begin(), rawChunk.ids.end());
+    }
+    return ids;
+}
+
+std::vector<TLEReader::RawChunk> TLEReader::parseFile(const IDFilter &idFilter, bool idsOnly) const {
+    const auto isLine1 = [](std::string_view line) {
+        return !line.empty() && line.front() == '1';
+    };
+    std::vector<RawChunk> rawChunks{};
+    //A compressed file arrives in several blocks, the next one is decompressed while this one is parsed
+    util::forEachTextBlock(_filepath, isLine1, [&](std::string_view text) {
+        //Several chunks per thread for a better load balance, every chunk starts with a line 1
+        const size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const auto chunks = util::splitIntoChunks(text, 4 * hardwareThreads, isLine1);
+        std::vector<RawChunk> blockChunks(chunks.size());
+        util::forEachIndex(chunks.size(), [&](size_t i) {
+            blockChunks[i] = parseChunk(chunks[i], idFilter, idsOnly);
+        });
 
-    while (std::getline(fileStream, line)) {
-        if (line.rfind('1', 0) == 0) {
-            line1 = line;
-            line1Found = true;
-        } else if (line.rfind('2', 0) == 0 && line1Found) {
-            line2 = line;
-            auto pair = parseTLELines(line1, line2);
-            mapping.insert(pair);
-            line1Found = false;
+        for (auto &rawChunk : blockChunks) {
+            if (rawChunk.error.has_value()) {
+                throw std::runtime_error{rawChunk.error.value()};
+            }
+            rawChunks.push_back(std::move(rawChunk));
         }
+        return true;
+    });
+    return rawChunks;
+}
+
+TLEReader::RawChunk TLEReader::parseChunk(std::string_view chunk, const IDFilter &idFilter, bool idsOnly) const {
+    RawChunk rawChunk{};
+    std::string_view line1{};
+    bool line1Found = false;
+    try {
+        util::forEachLine(chunk, [&](std::string_view line) {
+            if (!line.empty() && line.front() == '1') {
+                line1 = line;
+                line1Found = true;
+            } else if (!line.empty() && line.front() == '2' && line1Found) {
+                line1Found = false;
+                const size_t id = parseID(line1, line);
+                //Skip the entry before parsing the remaining fields
+                if (idFilter && !idFilter(id)) {
+                    return;
+                }
+                rawChunk.ids.push_back(id);
+                if (idsOnly) {
+                    return;
+                }
+                auto [data, epoch, dragTerm] = parseTLELines(line1, line);
+                rawChunk.tleData.push_back(data);
+                rawChunk.epochs.push_back(epoch);
+                rawChunk.bstar.push_back(dragTerm);
+            }
+        });
+    } catch (std::exception &e) {
+        rawChunk.error = e.what();
     }
+    return rawChunk;
+}
 
-    return mapping;
+size_t TLEReader::parseID(std::string_view line1, std::string_view line2) const {
+    try {
+        const auto firstCharOfID = static_cast<unsigned char>(line2.at(2));
+        const size_t offset = firstCharOfID < alpha5NumberingSchemeOffset.size()
+                              ? alpha5NumberingSchemeOffset[firstCharOfID] : INVALID_ALPHA5;
+        if (offset == INVALID_ALPHA5) {
+            throw std::runtime_error{"Invalid Alpha-5 ID"};
+        }
+        return util::parseNumber<size_t>(line2.substr(3, 4)) + offset;
+    } catch (std::exception &e) {
+        throw malformedError(line1);
+    }
 }
 
-std::pair<size_t, OrbitalElements> TLEReader::parseTLELines(const std::string &line1, const std::string &line2) const {
-    size_t id;
+std::tuple<std::array<double, 6>, Epoch, double> TLEReader::parseTLELines(std::string_view line1,
+                                                                          std::string_view line2) const {
     std::array<double, 6> tleData{};
     int year;
     double fraction;
+    double bstar;
 
     try {
-        //ID
-        char firstCharOfID = line2.at(2);
-        std::string restID = line2.substr(3, 4);
-        id = std::stoul(restID);
-        id += alpha5NumberingSchemeOffset.at(firstCharOfID);
         //Mean Motion [rev/day]
-        tleData[0] = std::stod(line2.substr(52, 11));
+        tleData[0] = util::parseNumber<double>(line2.substr(52, 11));
         //Eccentricity
-        tleData[1] = std::stod("0." + line2.substr(26, 7));
+        tleData[1] = parseImpliedDecimal(line2.substr(26, 7));
         //Inclination [deg]
-        tleData[2] = std::stod(line2.substr(8, 8));
+        tleData[2] = util::parseNumber<double>(line2.substr(8, 8));
         //RAAN [deg]
-        tleData[3] = std::stod(line2.substr(17, 8));
+        tleData[3] = util::parseNumber<double>(line2.substr(17, 8));
         //Argument of Perigee [deg]
-        tleData[4] = std::stod(line2.substr(34, 8));
+        tleData[4] = util::parseNumber<double>(line2.substr(34, 8));
         //Mean Anomaly [deg]
-        tleData[5] = std::stod(line2.substr(43, 8));
+        tleData[5] = util::parseNumber<double>(line2.substr(43, 8));
 
         //The year
-        year = std::stoi(line1.substr(18, 2));
+        year = util::parseNumber<int>(line1.substr(18, 2));
         year = year < 57 ? year + 2000 : year + 1900;
-        //The fraction of the year
-        fraction = std::stod(line1.substr(20, 8));
+        //The day of the year with the fraction of the day (columns 21-32, all eight decimals are needed to tell
+        //the element sets of a TLE history apart)
+        fraction = util::parseNumber<double>(line1.substr(20, 12));
+        //B* with an implied leading decimal point and exponent, e.g. " 28098-4" --> 0.28098e-4
+        //A blank or missing field means no drag, B* is only required for the SGP4 propagation
+        const std::string_view bstarField = line1.size() > 53 ? line1.substr(53, 8) : std::string_view{};
+        if (bstarField.find_first_not_of(' ') == std::string_view::npos) {
+            bstar = 0.0;
+        } else {
+            const double mantissa = parseImpliedDecimal(bstarField.substr(1, 5));
+            bstar = (bstarField.at(0) == '-' ? -mantissa : mantissa) *
+                    std::pow(10.0, util::parseNumber<int>(bstarField.substr(6, 2)));
+        }
 
     } catch (std::exception &e) {
-        throw std::runtime_error{"The TLE file \"" + _filepath +
-                                 "\" is malformed! Some Data could not be parsed correctly into valid numbers!\n"
-                                 "The issue appeared in the following line:\n"
-                                 + line1
-        };
+        throw malformedError(line1);
     }
 
-    OrbitalElementsFactory factory{};
-    Epoch epoch{year, fraction};
-    return std::make_pair(id, factory.createFromTLEData(tleData, epoch));
+    return std::make_tuple(tleData, Epoch{year, fraction}, bstar);
+}
+
+std::runtime_error TLEReader::malformedError(std::string_view line1) const {
+    return std::runtime_error{"The TLE file \"" + _filepath +
+                              "\" is malformed! Some Data could not be parsed correctly into valid numbers!\n"
+                              "The issue appeared in the following line:\n"
+                              + std::string{line1}
+    };
+}
+
+double TLEReader::parseImpliedDecimal(std::string_view digits) {
+    //"0." + digits in a stack buffer, so that the result is the correctly rounded value of the decimal
+    std::array<char, 32> buffer{'0', '.'};
+    const size_t length = std::min(digits.size(), buffer.size() - 2);
+    std::copy_n(digits.begin(), length, buffer.begin() + 2);
+    return util::parseNumber<double>(std::string_view{buffer.data(), length + 2});
 }
@@ -3,14 +3,87 @@
 #include <utility>
 #include <array>
 #include <map>
+#include <tuple>
+#include <vector>
 #include <string>
-#include <sstream>
-#include <fstream>
+#include <string_view>
+#include <optional>
+#include <functional>
+#include <thread>
+#include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include "breakupModel/model/OrbitalElementsFactory.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityFile.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * One entry of a TLE file: The Orbital Elements and the ballistic drag term B* which is required by SGP4.
+ */
+struct TLEEntry {
+
+    /**
+     * The Orbital Elements (the TLE mean elements converted to the simulation units) with the TLE epoch
+     */
+    OrbitalElements orbitalElements;
+
+    /**
+     * The drag term B* in [1/earth radii]
+     */
+    double bstar;
+
+};
+
+/**
+ * All entries of a TLE file in an SoA (Structure of Arrays) way, in the order of the file (duplicates included).
+ */
+struct TLEColumns {
+
+    /**
+     * The satellite ID of each entry (Alpha-5 resolved)
+     */
+    std::vector<size_t> id{};
+
+    /**
+     * The Orbital Elements of each entry, see OrbitalElementsColumns
+     */
+    OrbitalElementsColumns orbitalElements{};
+
+    /**
+     * The TLE epoch of each entry
+     */
+    std::vector<Epoch> epoch{};
+
+    /**
+     * The drag term B* of each entry in [1/earth radii]
+     */
+    std::vector<double> bstar{};
+
+    /**
+     * Returns the number of entries.
+     * @return size
+     */
+    [[nodiscard]] size_t size() const {
+        return id.size();
+    }
+
+    /**
+     * Returns one entry as TLEEntry.
+     * @param index - the index of the entry
+     * @return TLEEntry
+     */
+    [[nodiscard]] TLEEntry getEntry(size_t index) const {
+        return TLEEntry{OrbitalElements{orbitalElements.getElement(index).getAsArray(), epoch[index]}, bstar[index]};
+    }
+
+};
 
 /**
  * Provides the functionality to parse a TLE (Two-Line-Format) with the Alpha-5 scheme.
+ * The file is memory-mapped and split into chunks at the record boundaries (lines starting with '1'), the chunks are
+ * parsed in parallel directly from the mapped bytes with std::from_chars. A gzip-compressed file is decompressed in
+ * blocks on a background thread (see util::forEachTextBlock) and parsed block by block.
  * @note The TLE reader ONLY extracts arguments used by the simulation the rest is "thrown away". This behavior can be
  * modified if wished.
  */
@@ -19,14 +92,21 @@ class TLEReader {
     const std::string _filepath;
 
     /**
-     * This maps the first char of the ID to the corresponding offset.
-     * Notice that letters 'I' and 'O' does not have any mapping
+     * This maps the first char of the ID (as index) to the corresponding offset.
+     * Notice that letters 'I' and 'O' (like every other invalid char) map to INVALID_ALPHA5
      * @related For further information about the mapping have a look at https://www.space-track.org
      */
-    static const std::map<char, size_t> alpha5NumberingSchemeOffset;
+    static const std::array<size_t, 128> alpha5NumberingSchemeOffset;
+
+    static constexpr size_t INVALID_ALPHA5 = static_cast<size_t>(-1);
 
 public:
 
+    /**
+     * Predicate which returns true for the IDs which should be parsed (called concurrently, must be thread-safe)
+     */
+    using IDFilter = std::function<bool(size_t)>;
+
     /**
      * Constructs are new TLE Reader.
      * @param filepath
@@ -51,15 +131,95 @@ public:
      */
     std::map<size_t, OrbitalElements> getMappingIDOrbitalElements() const;
 
+    /**
+     * Returns a mapping from satellites ID to their TLE entry (Orbital Elements and the drag term B*).
+     * @return mapping ID and TLEEntry
+     * @throws an exception if the TLE is malformed or any other issues are encountered during the parsing
+     */
+    std::map<size_t, TLEEntry> getMappingIDTLEEntries() const;
+
+    /**
+     * Returns all entries of the TLE file in the order of the file as SoA (no mapping, duplicate IDs are kept).
+     * This is the parallel bulk parser behind the mappings.
+     * @param idFilter - if given, only the entries whose ID passes the filter are parsed and converted, the others are
+     * skipped right after reading their ID (default: all entries)
+     * @return TLEColumns
+     * @throws an exception if the TLE is malformed or any other issues are encountered during the parsing
+     */
+    TLEColumns getTLEColumns(const IDFilter &idFilter = nullptr) const;
+
+    /**
+     * Returns the IDs of all entries in the order of the file without parsing the remaining fields.
+     * @return vector of IDs (duplicates included)
+     * @throws an exception if an ID is malformed
+     */
+    std::vector<size_t> getIDs() const;
+
 private:
 
     /**
-     * Parses the line two of an TLE entry to a pair of ID and Kepler elements.
-     * @param line1 - the input stream
-     * @return a pair of ID and KeplerElements
+     * The raw entries of one chunk of the file in the order of the chunk.
+     */
+    struct RawChunk {
+        std::vector<size_t> ids{};
+        std::vector<std::array<double, 6>> tleData{};
+        std::vector<Epoch> epochs{};
+        std::vector<double> bstar{};
+        std::optional<std::string> error{};
+    };
+
+    /**
+     * Parses all entries of one chunk. Errors are saved in the chunk instead of being thrown, since exceptions must
+     * not leave a parallel algorithm.
+     * @param chunk - part of the file beginning with a record
+     * @param idFilter - entries whose ID does not pass the filter are skipped (nullptr for all)
+     * @param idsOnly - if true, only the IDs are parsed
+     * @return RawChunk
+     */
+    RawChunk parseChunk(std::string_view chunk, const IDFilter &idFilter, bool idsOnly) const;
+
+    /**
+     * Parses the chunks of the whole file (block by block if it is compressed) in parallel, see parseChunk().
+     * @param idFilter - entries whose ID does not pass the filter are skipped (nullptr for all)
+     * @param idsOnly - if true, only the IDs are parsed
+     * @return the RawChunks in the order of the file
+     * @throws an exception if the TLE is malformed
+     */
+    std::vector<RawChunk> parseFile(const IDFilter &idFilter, bool idsOnly) const;
+
+    /**
+     * Parses the (Alpha-5) ID of an entry.
+     * @param line1 - the first line of the entry (for the error message)
+     * @param line2 - the second line of the entry
+     * @return ID
+     * @throws an exception if the ID is malformed
+     */
+    size_t parseID(std::string_view line1, std::string_view line2) const;
+
+    /**
+     * Parses the two lines of an TLE entry (without the ID) to a tuple of raw TLE data, Epoch and B*.
+     * The conversion to OrbitalElements is done afterwards for all entries at once.
+     * @param line1 - the first line of the entry
+     * @param line2 - the second line of the entry
+     * @return a tuple of TLE data (in the order of OrbitalElementsFactory::createFromTLEData()), Epoch and B*
      * @throws an exception if the TLE is malformed or any other issues are encountered during the parsing
      */
-    std::pair<size_t, OrbitalElements> parseTLELines(const std::string &line1, const std::string &line2) const;
+    std::tuple<std::array<double, 6>, Epoch, double> parseTLELines(std::string_view line1,
+                                                                   std::string_view line2) const;
+
+    /**
+     * Creates the exception thrown for a malformed entry.
+     * @param line1 - the first line of the entry
+     * @return runtime_error
+     */
+    std::runtime_error malformedError(std::string_view line1) const;
+
+    /**
+     * Parses a field with an implied leading decimal point (e.g. the eccentricity "0006703" --> 0.0006703).
+     * @param digits - the digits after the decimal point
+     * @return the number
+     */
+    static double parseImpliedDecimal(std::string_view digits);
 
 };
 
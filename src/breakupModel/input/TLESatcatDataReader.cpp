@@ -1,44 +1,224 @@
 #include "TLESatcatDataReader.h"
 
 std::vector<Satellite> TLESatcatDataReader::getSatelliteCollection() const {
+    return this->getCatalog().getSatellites();
+}
+
+void TLESatcatDataReader::forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const {
+    this->createCatalogs(this->getSatcatEntries(), this->selectEntries(_tleReader.getTLEColumns()), batchSize,
+                         [&visitor](Catalog &catalog) {
+                             auto batch = catalog.getSatellites();
+                             visitor(batch);
+                         });
+}
+
+Catalog TLESatcatDataReader::getCatalog() const {
+    Catalog catalog{};
+    //The whole catalog is converted as one batch
+    this->createCatalogs(this->getSatcatEntries(), this->selectEntries(_tleReader.getTLEColumns()), SIZE_MAX,
+                         [&catalog](Catalog &batch) { catalog = std::move(batch); });
+    return catalog;
+}
+
+std::vector<Satellite> TLESatcatDataReader::getFilteredSatelliteCollection(const std::set<size_t> &idFilter) const {
+    auto isSelected = [&idFilter](size_t id) { return idFilter.count(id) != 0; };
     std::vector<Satellite> satellites{};
-    SatelliteBuilder satelliteBuilder{};
+    this->createCatalogs(_satcatReader.getFilteredColumns<2, 0, 2, 3, 13>(isSelected),
+                         this->selectEntries(_tleReader.getTLEColumns(isSelected)), SIZE_MAX,
+                         [&satellites](Catalog &catalog) { satellites = catalog.getSatellites(); });
+    return satellites;
+}
+
+std::vector<size_t> TLESatcatDataReader::updateCatalog(Catalog &catalog, const std::string &tleUpdateFilename) const {
+    if (catalog.size() > 0 && catalog.hasOrbitalElements() == _propagationEpoch.has_value()) {
+        throw std::runtime_error{"The catalog has not the state representation of this TLE Satcat Data Reader!"};
+    }
+    const size_t oldSize = catalog.size();
+    const auto catalogIndex = util::IdIndex::build(oldSize, [&](size_t i) { return catalog.id[i]; });
+    const TLEColumns tle = this->selectEntries(TLEReader{tleUpdateFilename}.getTLEColumns());
+    const auto tleIndex = util::IdIndex::build(tle.size(), [&](size_t i) { return tle.id[i]; });
+
+    //Contained objects keep their satcat fields (the area is the RCS), new ones are read from the satcat
+    std::vector<SatcatEntry> satcat = _satcatReader.getFilteredColumns<2, 0, 2, 3, 13>([&](size_t id) {
+        return tleIndex.contains(id) && !catalogIndex.contains(id);
+    });
+    for (size_t i = 0; i < tle.size(); ++i) {
+        const size_t row = catalogIndex.find(tle.id[i]);
+        if (row != util::IdIndex::NOT_FOUND && tleIndex.find(tle.id[i]) == i) {
+            satcat.emplace_back(std::string{catalog.getName(row)}, catalog.id[row], catalog.satType[row],
+                                catalog.area[row]);
+        }
+    }
+
+    std::vector<size_t> touched{};
+    this->createCatalogs(satcat, tle, SIZE_MAX, [&](Catalog &update) {
+        std::vector<size_t> appended{};
+        for (size_t i = 0; i < update.size(); ++i) {
+            const size_t row = catalogIndex.find(update.id[i]);
+            if (row == util::IdIndex::NOT_FOUND) {
+                appended.push_back(i);
+                continue;
+            }
+            if (catalog.hasOrbitalElements()) {
+                catalog.orbitalElements.setElement(row, update.orbitalElements.getElement(i).getAsArray());
+                catalog.epoch[row] = update.epoch[i];
+            } else {
+                catalog.position[row] = update.position[i];
+                catalog.velocity[row] = update.velocity[i];
+            }
+            touched.push_back(row);
+        }
+        const size_t begin = catalog.size();
+        catalog.append(update, appended);
+        for (size_t i = 0; i < appended.size(); ++i) {
+            touched.push_back(begin + i);
+        }
+    });
+    std::sort(touched.begin(), touched.end());
+    spdlog::info("Updated {} and appended {} objects of the catalog from {}",
+                 touched.size() - (catalog.size() - oldSize), catalog.size() - oldSize, tleUpdateFilename);
+    return touched;
+}
+
+size_t TLESatcatDataReader::getMaximalID() const {
+    const auto satcatIDs = _satcatReader.getColumn<2>();
+    const auto satcatIndex = util::IdIndex::build(satcatIDs.size(), [&](size_t i) { return satcatIDs[i]; });
+    if (!_propagationEpoch.has_value()) {
+        size_t maximalID = 0;
+        for (const size_t id : _tleReader.getIDs()) {
+            if (id > maximalID && satcatIndex.contains(id)) {
+                maximalID = id;
+            }
+        }
+        return maximalID;
+    }
+
+    //Like in createCatalog objects which decay until the propagation epoch are excluded, only the joined entries with
+    //the highest IDs are propagated until one of them does not decay
+    const auto tle = this->selectEntries(_tleReader.getTLEColumns());
+    std::vector<size_t> candidates{};
+    for (size_t i = 0; i < tle.size(); ++i) {
+        if (satcatIndex.contains(tle.id[i])) {
+            candidates.push_back(i);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [&tle](size_t lhs, size_t rhs) { return tle.id[lhs] > tle.id[rhs]; });
+    for (const size_t candidate : candidates) {
+        const auto entry = tle.getEntry(candidate);
+        const auto [position, velocity] = SGP4Propagator{}.propagate(
+                OrbitalElementsColumns::fromAoS({entry.orbitalElements}), {entry.bstar},
+                {entry.orbitalElements.getEpoch().secondsUntil(_propagationEpoch.value())});
+        if (!std::isnan(position[0][0])) {
+            return tle.id[candidate];
+        }
+    }
+    return 0;
+}
 
-    auto mappingSatcat = this->getSatcatMapping();
-    auto mappingTLE = _tleReader.getMappingIDOrbitalElements();
+std::pair<std::vector<Satellite>, size_t>
+TLESatcatDataReader::getFilteredSatelliteCollectionWithMaximalID(const std::set<size_t> &idFilter) const {
+    return std::make_pair(this->getFilteredSatelliteCollection(idFilter), this->getMaximalID());
+}
 
-    satellites.reserve(std::max(mappingSatcat.size(), mappingTLE.size()));
+std::vector<TLESatcatDataReader::SatcatEntry> TLESatcatDataReader::getSatcatEntries() const {
+    return _satcatReader.getColumns<0, 2, 3, 13>();
+}
 
-    //We just search for satellites which appear in both mappings
+TLEColumns TLESatcatDataReader::selectEntries(TLEColumns tle) const {
+    if (_propagationEpoch.has_value()) {
+        //A TLE history contains several element sets per ID, the one closest to the common epoch is propagated
+        return TLEHistory{tle}.getClosestColumns(_propagationEpoch.value());
+    }
+    return tle;
+}
+
+void TLESatcatDataReader::createCatalogs(const std::vector<SatcatEntry> &satcat, const TLEColumns &tle,
+                                         size_t batchSize, const std::function<void(Catalog &)> &visitor) const {
+    //We just search for satellites which appear in both files
     // --> No missing data possible (but not necessarily wrong information
-    for (auto const& [id, orbitalElements] : mappingTLE) {
-        if (mappingSatcat.count(id) != 0) {
-            auto &dataSatcat = mappingSatcat[id];
-            satellites.push_back(
-                    satelliteBuilder
-                            .reset()
-                            .setID(id)
-                            .setName(std::get<0>(dataSatcat))
-                            .setSatType(std::get<1>(dataSatcat))
-                            .setMassByArea(std::get<2>(dataSatcat))
-                            .setOrbitalElements(orbitalElements)
-                            .getResult()
-            );
+    const auto satcatIndex = util::IdIndex::build(satcat.size(), [&](size_t i) { return std::get<1>(satcat[i]); });
+    const auto joined = join(tle, satcatIndex);
+
+    batchSize = std::max(batchSize, size_t{1});
+    for (size_t begin = 0; begin < joined.size(); begin += std::min(batchSize, joined.size() - begin)) {
+        const size_t size = std::min(batchSize, joined.size() - begin);
+        auto catalog = this->createCatalog(satcat, tle, joined, begin, size);
+        if (catalog.size() > 0) {
+            visitor(catalog);
         }
     }
-    return satellites;
 }
 
-std::map<size_t, std::tuple<std::string, SatType, double>> TLESatcatDataReader::getSatcatMapping() const {
-    std::map<size_t, std::tuple<std::string, SatType, double>> mapping{};
+Catalog TLESatcatDataReader::createCatalog(const std::vector<SatcatEntry> &satcat, const TLEColumns &tle,
+                                           const std::vector<std::pair<size_t, size_t>> &joined,
+                                           size_t begin, size_t size) const {
+    //The rows of the batch which are part of the catalog (without propagation all of them)
+    std::vector<size_t> rows(size);
+    util::forEachIndex(size, [&](size_t i) { rows[i] = i; });
 
-    //If the mapping should contain more infos --> Here's the code to change that
-    auto satcat = _satcatReader.getLines();
-    for (auto const& [name, identifier, id, type, statusCode, owner, launchDate, launchSite, decayDate, period,
-                      inclination, apogee, perigee, rcs, dataStatusCode, orbitCenter, OrbitType] : satcat) {
+    util::ColumnVector<std::array<double, 3>> position{};
+    util::ColumnVector<std::array<double, 3>> velocity{};
+    if (_propagationEpoch.has_value()) {
+        //Bring all objects from their individual TLE epoch to the common epoch at once
+        std::vector<OrbitalElements> orbitalElements(size);
+        std::vector<double> bstar(size);
+        std::vector<double> timeSteps(size);
+        util::forEachIndex(size, [&](size_t i) {
+            const auto entry = tle.getEntry(joined[begin + i].first);
+            orbitalElements[i] = entry.orbitalElements;
+            bstar[i] = entry.bstar;
+            timeSteps[i] = entry.orbitalElements.getEpoch().secondsUntil(_propagationEpoch.value());
+        });
+        std::tie(position, velocity) =
+                SGP4Propagator{}.propagate(OrbitalElementsColumns::fromAoS(orbitalElements), bstar, timeSteps);
+        rows.erase(std::remove_if(rows.begin(), rows.end(), [&](size_t i) {
+            if (std::isnan(position[i][0])) {
+                spdlog::warn("The satellite with ID {} could not be propagated to the common epoch (decayed). "
+                             "It is therefore not part of the input!", tle.id[joined[begin + i].first]);
+                return true;
+            }
+            return false;
+        }), rows.end());
+    }
 
-        mapping.insert(std::make_pair(id, std::make_tuple(name, type, rcs)));
+    //The osculating Orbital Elements of propagated objects are derived later from their state if required
+    Catalog catalog{rows.size(), !_propagationEpoch.has_value()};
+    for (size_t row = 0; row < rows.size(); ++row) {
+        catalog.setName(row, std::get<0>(satcat[joined[begin + rows[row]].second]));
     }
+    util::forEachIndex(rows.size(), [&](size_t row) {
+        const size_t i = rows[row];
+        const auto &[name, id, satType, rcs] = satcat[joined[begin + i].second];
+        catalog.id[row] = id;
+        catalog.satType[row] = satType;
+        catalog.setMassByArea(row, rcs);
+        if (_propagationEpoch.has_value()) {
+            catalog.position[row] = position[i];
+            catalog.velocity[row] = velocity[i];
+        } else {
+            const size_t entry = joined[begin + i].first;
+            catalog.orbitalElements.setElement(row, tle.orbitalElements.getElement(entry).getAsArray());
+            catalog.epoch[row] = tle.epoch[entry];
+        }
+    });
+    return catalog;
+}
 
-    return mapping;
+std::vector<std::pair<size_t, size_t>> TLESatcatDataReader::join(const TLEColumns &tle,
+                                                                 const util::IdIndex &satcatIndex) {
+    //Only the first TLE entry of an ID is used
+    const auto tleIndex = util::IdIndex::build(tle.size(), [&](size_t i) { return tle.id[i]; });
+    std::vector<std::pair<size_t, size_t>> joined{};
+    joined.reserve(std::min(tleIndex.size(), satcatIndex.size()));
+    for (size_t i = 0; i < tle.size(); ++i) {
+        const size_t satcatRow = satcatIndex.find(tle.id[i]);
+        if (satcatRow != util::IdIndex::NOT_FOUND && tleIndex.find(tle.id[i]) == i) {
+            joined.emplace_back(i, satcatRow);
+        }
+    }
+    std::sort(joined.begin(), joined.end(), [&](const auto &lhs, const auto &rhs) {
+        return tle.id[lhs.first] < tle.id[rhs.first];
+    });
+    return joined;
 }
@@ -1,20 +1,35 @@
 #pragma once
 
 #include <string>
-#include <map>
+#include <vector>
+#include <utility>
 #include <tuple>
+#include <optional>
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include "DataSource.h"
 #include "CSVReader.h"
 #include "TLEReader.h"
+#include "TLEHistory.h"
 #include "breakupModel/model/Satellite.h"
-#include "breakupModel/model/SatelliteBuilder.h"
+#include "breakupModel/model/Catalog.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/propagation/SGP4Propagator.h"
+#include "breakupModel/util/UtilityHashIndex.h"
+#include "breakupModel/util/UtilityParallel.h"
+#include "spdlog/spdlog.h"
 
 /**
  * Class which reads data from a tle.txt and a satcat.csv
  */
 class TLESatcatDataReader : public DataSource {
 
+    /**
+     * The fields of a satcat.csv row used by the simulation: Name, ID, Object-Type, RCS
+     */
+    using SatcatEntry = std::tuple<std::string, size_t, SatType, double>;
+
     /**
      * Delegation to read the satcat.csv
      * Important fields for the Breakup Simulation are:<br>
@@ -34,48 +49,162 @@ class TLESatcatDataReader : public DataSource {
      */
     TLEReader _tleReader;
 
+    /**
+     * If given all satellites are propagated with SGP4 from their individual TLE epoch to this common epoch
+     */
+    std::optional<Epoch> _propagationEpoch{std::nullopt};
+
 public:
 
     /**
      * Creates a new TLE Satcat Data Reader.
      * @param satcatFilename
      * @param telFilename
+     * @param propagationEpoch - the common epoch to propagate all satellites to (default none, every satellite keeps
+     * its TLE epoch)
      * @throws if one file does not exists this constructor will "rethrow" the exception
      */
-    TLESatcatDataReader(const std::string &satcatFilename, const std::string &telFilename)
+    TLESatcatDataReader(const std::string &satcatFilename, const std::string &telFilename,
+                        std::optional<Epoch> propagationEpoch = std::nullopt)
             : _satcatReader{satcatFilename, true},
-              _tleReader(telFilename) {}
+              _tleReader(telFilename),
+              _propagationEpoch{propagationEpoch} {}
 
     /**
      * Creates a new TLE Satcat Data Reader.
-     * @param satcatFilename
-     * @param telFilename
+     * @param csvReader - the reader of the satcat.csv
+     * @param tleReader - the reader of the tle.txt
+     * @param propagationEpoch - the common epoch to propagate all satellites to (default none, every satellite keeps
+     * its TLE epoch)
      * @throws if one file does not exists this constructor will "rethrow" the exception
      */
     TLESatcatDataReader(const CSVReader<std::string, std::string, size_t,
             SatType, std::string, std::string, std::string, std::string, std::string,
             double, double, double, double, double,
-            std::string, std::string, std::string> &csvReader, const TLEReader &tleReader)
+            std::string, std::string, std::string> &csvReader, const TLEReader &tleReader,
+                        std::optional<Epoch> propagationEpoch = std::nullopt)
             : _satcatReader{csvReader},
-              _tleReader{tleReader} {}
+              _tleReader{tleReader},
+              _propagationEpoch{propagationEpoch} {}
 
     /**
      * Returns the a SatelliteCollection by reading the given satcat.csv and TLE data.
      * Neither of the two of them contains all necessary information. So this method also merges the information
-     * by using the unique ID of each satellite.
+     * by using the unique ID of each satellite (hash join, the first entry of an ID in each file is used). The
+     * satellites are returned in ascending order of their IDs and are constructed in parallel.
+     * If a propagation epoch is given, the TLE element set closest to this epoch is taken for every ID (see
+     * TLEHistory) and the satellites are propagated with SGP4 to this epoch. Satellites which decay until then are
+     * dropped with a warning.
      * @return a Collection of Satellites
      * @throws a runtime_error if satcat or tle is corrupt
      */
     std::vector<Satellite> getSatelliteCollection() const override;
 
+    /**
+     * Streams the satellites of getSatelliteCollection() in batches. Both files are parsed into compact columns
+     * once, but the conversion (and propagation) to the cartesian state and the construction of the Satellites is
+     * done batch by batch, so only one batch of Satellites is resident at a time.
+     * @param batchSize - the maximal number of satellites per batch (decayed satellites can make a batch smaller)
+     * @param visitor - called for every batch
+     * @throws a runtime_error if satcat or tle is corrupt
+     */
+    void forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const override;
+
+    /**
+     * Returns the joined objects of getSatelliteCollection() as compact Catalog without constructing Satellites.
+     * Without propagation epoch the Orbital Elements of the TLEs are kept as they are, otherwise the propagated
+     * cartesian state is saved.
+     * @return Catalog sorted by ascending ID
+     * @throws a runtime_error if satcat or tle is corrupt
+     */
+    Catalog getCatalog() const override;
+
+    /**
+     * Applies a TLE update file (e.g. the daily delta) to a catalog created by getCatalog() in place: The element
+     * sets of IDs which are already contained are replaced, IDs which are new and contained in the satcat are
+     * appended (the catalog is then no longer sorted by ID). Only the entries of the update file are parsed, converted
+     * and, if a propagation epoch is given, propagated; the rest of the catalog is not touched.
+     * @param catalog - the Catalog to update
+     * @param tleUpdateFilename - the TLE file with the changed and new element sets
+     * @return the indices of the updated and appended objects in ascending order
+     * @note Objects which decay until the propagation epoch keep their previous state
+     * @throws a runtime_error if the file does not exist, is corrupt or the catalog has another state representation
+     */
+    std::vector<size_t> updateCatalog(Catalog &catalog, const std::string &tleUpdateFilename) const;
+
+    /**
+     * Returns only the satellites whose ID is contained in the filter. The filter is pushed down into both readers,
+     * the records of other IDs are skipped before their numbers are parsed and before any conversion.
+     * @param idFilter - the IDs to keep
+     * @return a Collection of Satellites
+     * @throws a runtime_error if satcat or tle is corrupt
+     */
+    std::vector<Satellite> getFilteredSatelliteCollection(const std::set<size_t> &idFilter) const override;
+
+    /**
+     * Returns the maximal ID of the satellites contained in both files. Without propagation epoch only the ID columns
+     * are parsed. Otherwise satellites which decay until the propagation epoch are excluded like in getCatalog(), only
+     * the objects with the highest IDs are propagated until one of them does not decay.
+     * @return maximal ID or zero if no ID is contained in both files
+     * @throws a runtime_error if satcat or tle is corrupt
+     */
+    size_t getMaximalID() const override;
+
+    /**
+     * Combines getFilteredSatelliteCollection() and getMaximalID(), both only parse the columns they require, so the
+     * files are not converted completely.
+     * @param idFilter - the IDs to keep
+     * @return pair<a Collection of Satellites, maximal ID>
+     * @throws a runtime_error if satcat or tle is corrupt
+     */
+    std::pair<std::vector<Satellite>, size_t>
+    getFilteredSatelliteCollectionWithMaximalID(const std::set<size_t> &idFilter) const override;
+
 private:
 
     /**
-     * Returns a mapping of satellites ID to its name, type and Radar Cross Section (RCS) in [m^2]
-     * @return mapping <ID, infos>
-     * @throws a runtime_error if satcat is corrupt
+     * Reads the used fields of all satcat rows (the other cells are not parsed).
+     * @return vector of SatcatEntry in the order of the file
+     */
+    std::vector<SatcatEntry> getSatcatEntries() const;
+
+    /**
+     * Selects the TLE entries used for the satellites: All entries if there is no propagation epoch (the join keeps
+     * the first one of an ID), otherwise the element set of each ID which is closest to the propagation epoch.
+     * @param tle - the TLE entries in file order
+     * @return the selected entries
+     */
+    TLEColumns selectEntries(TLEColumns tle) const;
+
+    /**
+     * Joins the satcat rows and TLE entries and creates the catalog batch by batch.
+     * @param satcat - the satcat rows
+     * @param tle - the TLE entries in file order
+     * @param batchSize - the maximal number of objects per batch
+     * @param visitor - called for every (non-empty) batch, the objects are sorted by ascending ID
+     */
+    void createCatalogs(const std::vector<SatcatEntry> &satcat, const TLEColumns &tle, size_t batchSize,
+                        const std::function<void(Catalog &)> &visitor) const;
+
+    /**
+     * Creates the catalog of a range of joined entries, decayed objects are dropped with a warning.
+     * @param satcat - the satcat rows
+     * @param tle - the TLE entries in file order
+     * @param joined - pairs of <TLE entry, satcat row>, see join()
+     * @param begin - the first joined entry of the batch
+     * @param size - the number of joined entries of the batch
+     * @return the catalog of the batch
+     */
+    Catalog createCatalog(const std::vector<SatcatEntry> &satcat, const TLEColumns &tle,
+                          const std::vector<std::pair<size_t, size_t>> &joined, size_t begin, size_t size) const;
+
+    /**
+     * Joins the TLE entries with the satcat rows by their ID.
+     * @param tle - the TLE entries in file order
+     * @param satcatIndex - the index from ID to satcat row
+     * @return pairs of <TLE entry, satcat row> for every ID contained in both, sorted by ascending ID
      */
-    std::map<size_t, std::tuple<std::string, SatType, double>> getSatcatMapping() const;
+    static std::vector<std::pair<size_t, size_t>> join(const TLEColumns &tle, const util::IdIndex &satcatIndex);
 
 };
 
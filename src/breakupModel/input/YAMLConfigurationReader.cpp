@@ -42,16 +42,19 @@ std::shared_ptr<const DataSource> YAMLConfigurationReader::getDataReader() const
         }
     }
 
+    //fileName.npz
+    if (fileNames.size() == 1 && fileNames[0].size() > 4 && fileNames[0].substr(fileNames[0].size() - 4) == ".npz") {
+        return std::make_shared<NpzDataReader>(fileNames[0]);
     //fileName.yaml
-    if (fileNames.size() == 1 && fileNames[0].find(".yaml")) {
+    } else if (fileNames.size() == 1 && fileNames[0].find(".yaml")) {
         return std::make_shared<YAMLDataReader>(fileNames[0]);
     } else if (fileNames.size() == 2) {
         //fileName.csv (should be satcat) && fileName.txt (should be tle)
         if (fileNames[0].find(".csv") && fileNames[1].find(".txt")) {
-            return std::make_shared<TLESatcatDataReader>(fileNames[0], fileNames[1]);
+            return createTLESatcatDataReader(fileNames[0], fileNames[1]);
             //fileName.tle (should be tle) && fileName.csv (should be satcat)
         } else if (fileNames[0].find(".txt") && fileNames[1].find(".csv")) {
-            return std::make_shared<TLESatcatDataReader>(fileNames[1], fileNames[0]);
+            return createTLESatcatDataReader(fileNames[1], fileNames[0]);
         }
     }
     //Error Handling
@@ -64,6 +67,18 @@ std::shared_ptr<const DataSource> YAMLConfigurationReader::getDataReader() const
     throw std::runtime_error{message.str()};
 }
 
+std::shared_ptr<const DataSource> YAMLConfigurationReader::createTLESatcatDataReader(const std::string &satcatFilename,
+                                                                                    const std::string &tleFilename) const {
+    const auto propagationEpoch = getPropagationEpoch();
+    auto reader = std::make_shared<TLESatcatDataReader>(satcatFilename, tleFilename, propagationEpoch);
+    if (_file[SIMULATION_TAG][CATALOG_SNAPSHOT_TAG]) {
+        return std::make_shared<CatalogSnapshot>(_file[SIMULATION_TAG][CATALOG_SNAPSHOT_TAG].as<std::string>(),
+                                                 std::vector<std::string>{satcatFilename, tleFilename},
+                                                 propagationEpoch, reader);
+    }
+    return reader;
+}
+
 std::optional<std::set<size_t>> YAMLConfigurationReader::getIDFilter() const {
     if (_file[SIMULATION_TAG][ID_FILTER_TAG] && _file[SIMULATION_TAG][ID_FILTER_TAG].IsSequence()) {
         std::set<size_t> filterSet{};
@@ -83,6 +98,25 @@ bool YAMLConfigurationReader::getEnforceMassConservation() const {
     }
 }
 
+std::optional<Epoch> YAMLConfigurationReader::getPropagationEpoch() const {
+    auto node = _file[SIMULATION_TAG][PROPAGATION_EPOCH_TAG];
+    if (node) {
+        if (!node.IsSequence() || node.size() != 2) {
+            throw std::runtime_error{"The propagation epoch in the YAML Configuration file must be given as "
+                                     "[year, day.fraction]!"};
+        }
+        return std::make_optional<Epoch>(node[0].as<int>(), node[1].as<double>());
+    }
+    return std::nullopt;
+}
+
+std::optional<double> YAMLConfigurationReader::getCullingAltitude() const {
+    if (_file[SIMULATION_TAG][CULLING_ALTITUDE_TAG]) {
+        return std::make_optional(_file[SIMULATION_TAG][CULLING_ALTITUDE_TAG].as<double>());
+    }
+    return std::nullopt;
+}
+
 std::vector<std::shared_ptr<OutputWriter>> YAMLConfigurationReader::getOutputTargets() const {
     if (_file[RESULT_OUTPUT_TAG]) {
         return extractOutputWriter(_file[RESULT_OUTPUT_TAG]);
@@ -106,6 +140,12 @@ YAMLConfigurationReader::extractOutputWriter(const YAML::Node &node) {
     if (!node[TARGET_TAG]) {
         throw std::runtime_error{"You specified an output tag, but did not give it any targets!"};
     }
+    //Histograms replace the per fragment output for all targets
+    if (node[HISTOGRAM_TAG]) {
+        return extractHistogramWriter(node);
+    } else if (node[DENSITY_GRID_TAG]) {
+        return extractDensityGridWriter(node);
+    }
     //Start extracting the OutputWriter
     std::vector<std::shared_ptr<OutputWriter>> outputs{};
     for (auto outputFile : node[TARGET_TAG]) {
@@ -133,3 +173,73 @@ YAMLConfigurationReader::extractOutputWriter(const YAML::Node &node) {
     }
     return outputs;
 }
+
+std::vector<std::shared_ptr<OutputWriter>>
+YAMLConfigurationReader::extractHistogramWriter(const YAML::Node &node) {
+    auto type = node[HISTOGRAM_TAG].as<std::string>();
+    HistogramType histogramType;
+    if (type == "gabbard") {
+        histogramType = HistogramType::GABBARD;
+    } else if (type == "amlc") {
+        histogramType = HistogramType::AM_LC;
+    } else {
+        throw std::runtime_error{"The histogram " + type + " is not available! Available are gabbard and amlc"};
+    }
+    std::array<size_t, 2> bins{200, 200};
+    if (node[HISTOGRAM_BINS_TAG]) {
+        bins = {node[HISTOGRAM_BINS_TAG][0].as<size_t>(), node[HISTOGRAM_BINS_TAG][1].as<size_t>()};
+    }
+    auto ranges = HistogramWriter::defaultRanges(histogramType);
+    if (node[HISTOGRAM_RANGE_TAG]) {
+        for (size_t axis = 0; axis < 2; ++axis) {
+            ranges[axis] = {node[HISTOGRAM_RANGE_TAG][axis][0].as<double>(),
+                            node[HISTOGRAM_RANGE_TAG][axis][1].as<double>()};
+        }
+    }
+
+    std::vector<std::shared_ptr<OutputWriter>> outputs{};
+    for (auto outputFile : node[TARGET_TAG]) {
+        std::string filename{outputFile.as<std::string>()};
+        const std::string ending = filename.substr(filename.size() - std::min(filename.size(), size_t{3}));
+        if (ending == "csv" || ending == "npy") {
+            outputs.push_back(std::shared_ptr<OutputWriter>(new HistogramWriter(filename, histogramType, bins, ranges)));
+        } else {
+            spdlog::warn("The file {} is no available histogram form. Available are csv and npy Output", filename);
+        }
+    }
+    if (outputs.empty()) {
+        spdlog::warn("You have defined a histogram with no valid file formats!");
+    }
+    return outputs;
+}
+
+std::vector<std::shared_ptr<OutputWriter>>
+YAMLConfigurationReader::extractDensityGridWriter(const YAML::Node &node) {
+    auto ranges = DensityGridWriter::DEFAULT_RANGES;
+    auto bins = DensityGridWriter::DEFAULT_BINS;
+    //Each axis is optionally given as [min, max, bins]
+    const std::array<const char *, 3> axisTags{DENSITY_ALTITUDE_TAG, DENSITY_INCLINATION_TAG, DENSITY_RAAN_TAG};
+    const auto gridNode = node[DENSITY_GRID_TAG];
+    for (size_t axis = 0; axis < 3; ++axis) {
+        if (gridNode.IsMap() && gridNode[axisTags[axis]]) {
+            const auto axisNode = gridNode[axisTags[axis]];
+            ranges[axis] = {axisNode[0].as<double>(), axisNode[1].as<double>()};
+            bins[axis] = axisNode[2].as<size_t>();
+        }
+    }
+
+    std::vector<std::shared_ptr<OutputWriter>> outputs{};
+    for (auto outputFile : node[TARGET_TAG]) {
+        std::string filename{outputFile.as<std::string>()};
+        const std::string ending = filename.substr(filename.size() - std::min(filename.size(), size_t{3}));
+        if (ending == "csv" || ending == "npy") {
+            outputs.push_back(std::shared_ptr<OutputWriter>(new DensityGridWriter(filename, ranges, bins)));
+        } else {
+            spdlog::warn("The file {} is no available density grid form. Available are csv and npy Output", filename);
+        }
+    }
+    if (outputs.empty()) {
+        spdlog::warn("You have defined a density grid with no valid file formats!");
+    }
+    return outputs;
+}
@@ -5,10 +5,14 @@
 #include "InputConfigurationSource.h"
 #include "OutputConfigurationSource.h"
 #include "YAMLDataReader.h"
+#include "NpzDataReader.h"
 #include "TLESatcatDataReader.h"
+#include "CatalogSnapshot.h"
 #include "breakupModel/output/CSVWriter.h"
 #include "breakupModel/output/CSVPatternWriter.h"
 #include "breakupModel/output/VTKWriter.h"
+#include "breakupModel/output/HistogramWriter.h"
+#include "breakupModel/output/DensityGridWriter.h"
 #include "spdlog/spdlog.h"
 
 /**
@@ -27,11 +31,21 @@ class YAMLConfigurationReader : public InputConfigurationSource, public OutputCo
     static constexpr char INPUT_SOURCE_TAG[] = "inputSource";
     static constexpr char ID_FILTER_TAG[] = "idFilter";
     static constexpr char ENFORCE_MASS_CONSERVATION_TAG[] = "enforceMassConservation";
+    static constexpr char PROPAGATION_EPOCH_TAG[] = "propagationEpoch";
+    static constexpr char CULLING_ALTITUDE_TAG[] = "cullingAltitude";
+    static constexpr char CATALOG_SNAPSHOT_TAG[] = "catalogSnapshot";
     static constexpr char RESULT_OUTPUT_TAG[] = "resultOutput";
     static constexpr char INPUT_OUTPUT_TAG[] = "inputOutput";
     static constexpr char TARGET_TAG[] = "target";
     static constexpr char KEPLER_TAG[] = "kepler";
     static constexpr char CSV_PATTERN_TAG[] = "csvPattern";
+    static constexpr char HISTOGRAM_TAG[] = "histogram";
+    static constexpr char HISTOGRAM_BINS_TAG[] = "bins";
+    static constexpr char HISTOGRAM_RANGE_TAG[] = "range";
+    static constexpr char DENSITY_GRID_TAG[] = "densityGrid";
+    static constexpr char DENSITY_ALTITUDE_TAG[] = "altitude";
+    static constexpr char DENSITY_INCLINATION_TAG[] = "inclination";
+    static constexpr char DENSITY_RAAN_TAG[] = "raan";
 
     const YAML::Node _file;
 
@@ -104,6 +118,20 @@ public:
      */
     bool getEnforceMassConservation() const override;
 
+    /**
+     * Returns the common epoch to which all TLE input satellites are propagated (given as [year, day.fraction] like
+     * in the TLE format, e.g. [2021, 123.5]).
+     * @return the epoch or nullopt if not given
+     * @throws a runtime_error if the epoch is malformed
+     */
+    std::optional<Epoch> getPropagationEpoch() const override;
+
+    /**
+     * Returns the minimal perigee altitude in [m] below which fragments are removed after the breakup.
+     * @return the altitude or nullopt if not given
+     */
+    std::optional<double> getCullingAltitude() const override;
+
     /**
      * Reads in which Output is wished by the YAML file.
      * @return a vector containing the Outputs according to the YAML file
@@ -124,5 +152,31 @@ private:
      * @return a vector containing the OutputWriter according to the YAML file
      */
     static std::vector<std::shared_ptr<OutputWriter>> extractOutputWriter(const YAML::Node &node) ;
+
+    /**
+     * Internally used by extractOutputWriter() if the HISTOGRAM_TAG is given, every target becomes a HistogramWriter.
+     * @param node - the YAML Node RESULT_OUTPUT_TAG or either INPUT_OUTPUT_TAG
+     * @return a vector containing the HistogramWriter according to the YAML file
+     * @throws an exception if the histogram type is unknown
+     */
+    static std::vector<std::shared_ptr<OutputWriter>> extractHistogramWriter(const YAML::Node &node);
+
+    /**
+     * Internally used by extractOutputWriter() if the DENSITY_GRID_TAG is given, every target becomes a
+     * DensityGridWriter.
+     * @param node - the YAML Node RESULT_OUTPUT_TAG or either INPUT_OUTPUT_TAG
+     * @return a vector containing the DensityGridWriter according to the YAML file
+     */
+    static std::vector<std::shared_ptr<OutputWriter>> extractDensityGridWriter(const YAML::Node &node);
+
+    /**
+     * Internally used by getDataReader() for the TLE + Satcat input. If the CATALOG_SNAPSHOT_TAG is given, the reader
+     * is wrapped into a CatalogSnapshot which caches the joined catalog in the given file.
+     * @param satcatFilename - the satcat.csv
+     * @param tleFilename - the tle.txt
+     * @return the TLESatcatDataReader or the CatalogSnapshot wrapping it
+     */
+    std::shared_ptr<const DataSource> createTLESatcatDataReader(const std::string &satcatFilename,
+                                                                const std::string &tleFilename) const;
 };
 
@@ -1,18 +1,25 @@
 #include "YAMLDataReader.h"
 
-std::vector<Satellite> YAMLDataReader::getSatelliteCollection() const {
-    std::vector<Satellite> satelliteVector{};
+void YAMLDataReader::forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const {
+    batchSize = std::max(batchSize, size_t{1});
+    std::vector<Satellite> batch{};
     SatelliteBuilder satelliteBuilder{};
 
     if (_file[SATELLITES_TAG] && _file[SATELLITES_TAG].IsSequence()) {
         YAML::Node satellites{_file[SATELLITES_TAG]};
         for (auto satNode : satellites) {
-            satelliteVector.push_back(parseSatellite(satelliteBuilder, satNode));
+            batch.push_back(parseSatellite(satelliteBuilder, satNode));
+            if (batch.size() >= batchSize) {
+                visitor(batch);
+                batch.clear();
+            }
+        }
+        if (!batch.empty()) {
+            visitor(batch);
         }
     } else {
         throw std::runtime_error{"The was no satellites tag inside the YAML file, so no satellites were extracted!"};
     }
-    return satelliteVector;
 }
 
 Satellite YAMLDataReader::parseSatellite(SatelliteBuilder &satelliteBuilder, const YAML::Node &node) {
@@ -5,6 +5,7 @@
 #include <vector>
 #include <array>
 #include <utility>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include "yaml-cpp/yaml.h"
@@ -65,17 +66,15 @@ public:
             : _file{YAML::LoadFile(filename)} {}
 
     /**
-     * Returns a SatelliteCollection. Satellites are read from the YAML file.<br>
-     *
-     * If the file name is malformed or the file is corrupt in other ways,
-     * the returned SatelliteCollection will contain no satellites.<br>
+     * Streams the satellites of the YAML file in batches. Satellites are read from the YAML file.<br>
      *
      * If the file exists, but some satellites are invalid then the SatelliteCollection will only contain valid
      * satellites! A valid satellite is a satellites which has every date needed to run the simulation with it.<br>
-     * @return a SatelliteCollection
-     * @throws a runtime_error if a satellite is incomplete
+     * @param batchSize - the maximal number of satellites per batch
+     * @param visitor - called for every batch
+     * @throws a runtime_error if a satellite is incomplete or the file contains no satellites tag
      */
-    std::vector<Satellite> getSatelliteCollection() const override;
+    void forEachSatelliteBatch(size_t batchSize, const SatelliteBatchVisitor &visitor) const override;
 
 private:
 
@@ -0,0 +1,165 @@
+#include "Catalog.h"
+
+void Catalog::resize(size_t newSize, bool withOrbitalElements) {
+    const size_t oldSize = this->size();
+    _withOrbitalElements = withOrbitalElements;
+    //The first name is the empty one, so new objects refer to it
+    if (_names.empty()) {
+        this->intern(std::string_view{});
+    }
+    id.resize(newSize);
+    satType.resize(newSize);
+    characteristicLength.resize(newSize);
+    areaToMassRatio.resize(newSize);
+    mass.resize(newSize);
+    area.resize(newSize);
+    _nameIndex.resize(newSize);
+
+    util::firstTouch(id, oldSize);
+    util::firstTouch(satType, oldSize, SatType::SPACECRAFT);
+    util::firstTouch(characteristicLength, oldSize);
+    util::firstTouch(areaToMassRatio, oldSize);
+    util::firstTouch(mass, oldSize);
+    util::firstTouch(area, oldSize);
+    util::firstTouch(_nameIndex, oldSize);
+
+    if (withOrbitalElements) {
+        orbitalElements.resize(newSize);
+        epoch.resize(newSize);
+        position = {};
+        velocity = {};
+    } else {
+        const size_t oldStateSize = position.size();
+        position.resize(newSize);
+        velocity.resize(newSize);
+        util::firstTouch(position, oldStateSize);
+        util::firstTouch(velocity, oldStateSize);
+        orbitalElements.resize(0);
+        epoch = {};
+    }
+}
+
+void Catalog::append(const std::vector<Satellite> &satellites) {
+    if (_withOrbitalElements && this->size() > 0) {
+        throw std::runtime_error{"Satellites can only be appended to a catalog with a cartesian state!"};
+    }
+    const size_t begin = this->size();
+    this->resize(begin + satellites.size(), false);
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        this->setName(begin + i, satellites[i].getName());
+    }
+    util::forEachIndex(satellites.size(), [&](size_t i) {
+        const Satellite &satellite = satellites[i];
+        const size_t index = begin + i;
+        id[index] = satellite.getId();
+        satType[index] = satellite.getSatType();
+        characteristicLength[index] = satellite.getCharacteristicLength();
+        areaToMassRatio[index] = satellite.getAreaToMassRatio();
+        mass[index] = satellite.getMass();
+        area[index] = satellite.getArea();
+        position[index] = satellite.getPosition();
+        velocity[index] = satellite.getVelocity();
+    });
+}
+
+void Catalog::append(const Catalog &other, const std::vector<size_t> &indices) {
+    if (this->size() > 0 && _withOrbitalElements != other._withOrbitalElements) {
+        throw std::runtime_error{"Only catalogs with the same state representation can be appended!"};
+    }
+    const size_t begin = this->size();
+    this->resize(begin + indices.size(), other._withOrbitalElements);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        this->setName(begin + i, other.getName(indices[i]));
+    }
+    util::forEachIndex(indices.size(), [&](size_t i) {
+        const size_t source = indices[i];
+        const size_t index = begin + i;
+        id[index] = other.id[source];
+        satType[index] = other.satType[source];
+        characteristicLength[index] = other.characteristicLength[source];
+        areaToMassRatio[index] = other.areaToMassRatio[source];
+        mass[index] = other.mass[source];
+        area[index] = other.area[source];
+        if (_withOrbitalElements) {
+            orbitalElements.setElement(index, other.orbitalElements.getElement(source).getAsArray());
+            epoch[index] = other.epoch[source];
+        } else {
+            position[index] = other.position[source];
+            velocity[index] = other.velocity[source];
+        }
+    });
+}
+
+std::vector<Satellite> Catalog::getSatellites() const {
+    std::vector<size_t> indices(this->size());
+    util::forEachIndex(indices.size(), [&](size_t i) { indices[i] = i; });
+    return this->getSatellites(indices);
+}
+
+std::vector<Satellite> Catalog::getSatellites(const std::vector<size_t> &indices) const {
+    //One string per distinct name which is shared by the Satellites
+    std::vector<std::shared_ptr<const std::string>> names(_names.size());
+    for (const size_t index : indices) {
+        auto &name = names[_nameIndex[index]];
+        if (name == nullptr) {
+            name = std::make_shared<const std::string>(this->getName(index));
+        }
+    }
+
+    util::ColumnVector<std::array<double, 3>> cartesianPosition{};
+    util::ColumnVector<std::array<double, 3>> cartesianVelocity{};
+    std::vector<OrbitalElements> elements{};
+    if (_withOrbitalElements) {
+        elements.resize(indices.size());
+        util::forEachIndex(indices.size(), [&](size_t i) {
+            elements[i] = OrbitalElements{orbitalElements.getElement(indices[i]).getAsArray(), epoch[indices[i]]};
+        });
+        std::tie(cartesianPosition, cartesianVelocity) = OrbitalElementsColumns::fromAoS(elements).toCartesian();
+    }
+
+    std::vector<Satellite> satellites(indices.size());
+    util::forEachIndex(indices.size(), [&](size_t i) {
+        const size_t index = indices[i];
+        Satellite &satellite = satellites[i];
+        satellite.setId(id[index]);
+        satellite.setName(names[_nameIndex[index]]);
+        satellite.setSatType(satType[index]);
+        satellite.setCharacteristicLength(characteristicLength[index]);
+        satellite.setAreaToMassRatio(areaToMassRatio[index]);
+        satellite.setMass(mass[index]);
+        satellite.setArea(area[index]);
+        if (_withOrbitalElements) {
+            satellite.setCartesianByOrbitalElements(elements[i], cartesianPosition[i], cartesianVelocity[i]);
+        } else {
+            satellite.setPosition(position[index]);
+            satellite.setVelocity(velocity[index]);
+        }
+    });
+    return satellites;
+}
+
+std::vector<size_t> Catalog::findIndices(const std::set<size_t> &idFilter) const {
+    std::vector<size_t> indices{};
+    for (size_t i = 0; i < this->size(); ++i) {
+        if (idFilter.count(id[i]) != 0) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+std::uint32_t Catalog::intern(std::string_view name) {
+    const std::uint64_t hash = util::fnv1a(name);
+    const auto [first, last] = _nameLookup.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+        const auto &[offset, length] = _names[it->second];
+        if (std::string_view{_namePool}.substr(offset, length) == name) {
+            return it->second;
+        }
+    }
+    const auto index = static_cast<std::uint32_t>(_names.size());
+    _names.emplace_back(static_cast<std::uint32_t>(_namePool.size()), static_cast<std::uint32_t>(name.size()));
+    _namePool.append(name);
+    _nameLookup.emplace(hash, index);
+    return index;
+}
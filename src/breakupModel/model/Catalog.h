@@ -0,0 +1,241 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <string>
+#include <string_view>
+#include <set>
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
+#include "Satellite.h"
+#include "OrbitalElements.h"
+#include "OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityFunctions.h"
+#include "breakupModel/util/UtilityFile.h"
+#include "breakupModel/util/UtilityMemory.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * This class implements a catalog of (parent) objects in an SoA (Structure of Array) way.
+ * Compared to a std::vector<Satellite> it needs only a fraction of the memory: There is no heap string per object,
+ * the names are interned in one contiguous pool (the thousands of "... DEB" objects share one entry), and the state
+ * is saved in exactly one representation: Either as Orbital Elements with their epoch (e.g. a TLE catalog) or as
+ * cartesian position and velocity (e.g. a propagated catalog).
+ * Scans over one attribute (e.g. the IDs) therefore touch only this column.
+ * @note Only the objects which enter a breakup need to be converted to Satellites, see getSatellites()
+ */
+class Catalog {
+
+public:
+
+    /**
+     * The ID of each object
+     */
+    util::ColumnVector<size_t> id;
+
+    /**
+     * The SatType of each object
+     */
+    util::ColumnVector<SatType> satType;
+
+    /**
+     * The characteristic length of each object in [m]
+     */
+    util::ColumnVector<double> characteristicLength;
+
+    /**
+     * The area-to-mass ratio of each object in [m^2/kg]
+     */
+    util::ColumnVector<double> areaToMassRatio;
+
+    /**
+     * The mass of each object in [kg]
+     */
+    util::ColumnVector<double> mass;
+
+    /**
+     * The area/ Radar-Cross-Section of each object in [m^2]
+     */
+    util::ColumnVector<double> area;
+
+    /**
+     * The cartesian position of each object in [m] (empty if the catalog has Orbital Elements)
+     */
+    util::ColumnVector<std::array<double, 3>> position;
+
+    /**
+     * The cartesian velocity of each object in [m/s] (empty if the catalog has Orbital Elements)
+     */
+    util::ColumnVector<std::array<double, 3>> velocity;
+
+    /**
+     * The Orbital Elements of each object (empty if the catalog has a cartesian state)
+     */
+    OrbitalElementsColumns orbitalElements;
+
+    /**
+     * The epoch of the Orbital Elements of each object (empty if the catalog has a cartesian state)
+     */
+    std::vector<Epoch> epoch;
+
+private:
+
+    /**
+     * True if the state is saved in orbitalElements and epoch, false if in position and velocity
+     */
+    bool _withOrbitalElements{false};
+
+    /**
+     * The index of each object's name in _names
+     */
+    util::ColumnVector<std::uint32_t> _nameIndex;
+
+    /**
+     * The concatenated distinct names
+     */
+    std::string _namePool{};
+
+    /**
+     * The <offset, length> of each distinct name in the _namePool
+     */
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> _names{};
+
+    /**
+     * Maps the hash of a name to the indices of the distinct names with this hash (for interning)
+     */
+    std::unordered_multimap<std::uint64_t, std::uint32_t> _nameLookup{};
+
+public:
+
+    Catalog() = default;
+
+    /**
+     * Creates a catalog with size objects (all columns zero-initialized, every name empty).
+     * @param size - the number of objects
+     * @param withOrbitalElements - true if the state is saved as Orbital Elements, otherwise as cartesian vectors
+     */
+    Catalog(size_t size, bool withOrbitalElements) {
+        this->resize(size, withOrbitalElements);
+    }
+
+    /**
+     * Returns the number of objects.
+     * @return size
+     */
+    [[nodiscard]] size_t size() const {
+        return id.size();
+    }
+
+    /**
+     * Returns true if the state of the objects is saved as Orbital Elements.
+     * @return true if Orbital Elements, false if cartesian vectors
+     */
+    [[nodiscard]] bool hasOrbitalElements() const {
+        return _withOrbitalElements;
+    }
+
+    /**
+     * Resizes all columns (only those of the chosen state representation), new objects have an empty name.
+     * @param newSize - the number of objects
+     * @param withOrbitalElements - true if the state is saved as Orbital Elements, otherwise as cartesian vectors
+     */
+    void resize(size_t newSize, bool withOrbitalElements);
+
+    /**
+     * Returns the name of an object.
+     * @param index - the index of the object
+     * @return view into the name pool
+     */
+    [[nodiscard]] std::string_view getName(size_t index) const {
+        const auto &[offset, length] = _names[_nameIndex[index]];
+        return std::string_view{_namePool}.substr(offset, length);
+    }
+
+    /**
+     * Sets the name of an object, identical names are saved only once.
+     * @param index - the index of the object
+     * @param name - the name
+     * @note Not thread-safe, the names are set serially
+     */
+    void setName(size_t index, std::string_view name) {
+        _nameIndex[index] = this->intern(name);
+    }
+
+    /**
+     * Sets mass, area, characteristic length and area-to-mass ratio of an object derived from its radar cross
+     * section (like SatelliteBuilder::setMassByArea()).
+     * @param index - the index of the object
+     * @param radarCrossSection - the area in [m^2]
+     */
+    void setMassByArea(size_t index, double radarCrossSection) {
+        characteristicLength[index] = util::calculateCharacteristicLength(radarCrossSection);
+        mass[index] = util::calculateSphereMass(characteristicLength[index]);
+        area[index] = radarCrossSection;
+        areaToMassRatio[index] = radarCrossSection / mass[index];
+    }
+
+    /**
+     * Appends Satellites (their state is saved as cartesian vectors).
+     * @param satellites - the Satellites
+     * @throws std::runtime_error if this catalog saves Orbital Elements
+     */
+    void append(const std::vector<Satellite> &satellites);
+
+    /**
+     * Appends some objects of another catalog with the same state representation.
+     * @param other - the other Catalog
+     * @param indices - the indices of the objects in the other catalog
+     * @throws std::runtime_error if the state representations differ (and this catalog is not empty)
+     */
+    void append(const Catalog &other, const std::vector<size_t> &indices);
+
+    /**
+     * Converts one object to a Satellite.
+     * @param index - the index of the object
+     * @return Satellite
+     */
+    [[nodiscard]] Satellite getSatellite(size_t index) const {
+        return this->getSatellites({index}).front();
+    }
+
+    /**
+     * Converts all objects to Satellites.
+     * @return vector of Satellites in the order of the catalog
+     */
+    [[nodiscard]] std::vector<Satellite> getSatellites() const;
+
+    /**
+     * Converts some objects to Satellites. The cartesian state of all of them is calculated in one parallel batch
+     * (bit-identical to Satellite::setCartesianByOrbitalElements()), objects with the same name share the name
+     * string.
+     * @param indices - the indices of the objects
+     * @return vector of Satellites in the order of the indices
+     */
+    [[nodiscard]] std::vector<Satellite> getSatellites(const std::vector<size_t> &indices) const;
+
+    /**
+     * Returns the indices of the objects whose ID is contained in the filter (one scan over the ID column).
+     * @param idFilter - the IDs
+     * @return the indices in ascending order
+     */
+    [[nodiscard]] std::vector<size_t> findIndices(const std::set<size_t> &idFilter) const;
+
+    /**
+     * Returns the number of distinct names.
+     * @return number of names in the pool
+     */
+    [[nodiscard]] size_t getNameCount() const {
+        return _names.size();
+    }
+
+private:
+
+    /**
+     * Returns the index of a name in the pool, adds it if it is not yet contained.
+     * @param name - the name
+     * @return index in _names
+     */
+    std::uint32_t intern(std::string_view name);
+
+};
@@ -40,6 +40,19 @@ std::tm Epoch::toTm() const {
     return tmInstance;
 }
 
+double Epoch::toJulianDate() const {
+    //Julian Date of the 1st January 00:00 of the year (see Vallado, Algorithm 14), the fraction starts with day one
+    const double januaryFirst = 367.0 * year - std::floor(7.0 * year / 4.0) + 31.0 + 1721013.5;
+    return januaryFirst + fraction - 1.0;
+}
+
+double Epoch::secondsUntil(const Epoch &other) const {
+    //The whole days between the years are subtracted separately, which keeps the precision of the fractions
+    const double days = (367.0 * other.year - std::floor(7.0 * other.year / 4.0))
+                        - (367.0 * year - std::floor(7.0 * year / 4.0));
+    return (days + other.fraction - fraction) * 86400.0;
+}
+
 std::array<double, 6> OrbitalElements::getAsArray() const {
     return std::array<double, 6>{_semiMajorAxis, _eccentricity, _inclination,
                                  _longitudeOfTheAscendingNode, _argumentOfPeriapsis, _eccentricAnomaly};
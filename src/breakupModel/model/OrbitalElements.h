@@ -93,6 +93,19 @@ struct Epoch {
      * @return std::tm from ctime
      */
     [[nodiscard]] std::tm toTm() const;
+
+    /**
+     * Transforms the epoch into a Julian Date (valid for the years 1901 to 2099).
+     * @return Julian Date in [days]
+     */
+    [[nodiscard]] double toJulianDate() const;
+
+    /**
+     * Returns the time from this epoch until another epoch.
+     * @param other - the other epoch
+     * @return time difference in [s], negative if the other epoch lies before this one
+     */
+    [[nodiscard]] double secondsUntil(const Epoch &other) const;
 };
 
 class OrbitalElements {
@@ -0,0 +1,78 @@
+#include "OrbitalElementsColumns.h"
+
+OrbitalElementsColumns OrbitalElementsColumns::fromCartesian(const Satellites &satellites) {
+    OrbitalElementsColumns columns{satellites.size()};
+    util::forEachIndex(columns.size(), [&](size_t i) {
+        columns.setElement(i, util::cartesianToKeplerian(satellites.getPosition(i), satellites.velocity[i]));
+    });
+    return columns;
+}
+
+OrbitalElementsColumns OrbitalElementsColumns::fromAoS(const std::vector<OrbitalElements> &orbitalElements) {
+    OrbitalElementsColumns columns{orbitalElements.size()};
+    util::forEachIndex(columns.size(), [&](size_t i) {
+        columns.setElement(i, orbitalElements[i].getAsArray());
+    });
+    return columns;
+}
+
+std::pair<util::ColumnVector<std::array<double, 3>>, util::ColumnVector<std::array<double, 3>>>
+OrbitalElementsColumns::toCartesian() const {
+    util::ColumnVector<std::array<double, 3>> position(size());
+    util::ColumnVector<std::array<double, 3>> velocity(size());
+    util::forEachIndex(size(), [&](size_t i) {
+        auto [r, v] = util::keplerianToCartesian({semiMajorAxis[i], eccentricity[i], inclination[i],
+                                                  longitudeOfTheAscendingNode[i], argumentOfPeriapsis[i],
+                                                  eccentricAnomaly[i]});
+        position[i] = r;
+        velocity[i] = v;
+    });
+    return std::make_pair(std::move(position), std::move(velocity));
+}
+
+OrbitalElements OrbitalElementsColumns::getElement(size_t index) const {
+    return OrbitalElements{semiMajorAxis[index], eccentricity[index], inclination[index],
+                           longitudeOfTheAscendingNode[index], argumentOfPeriapsis[index], eccentricAnomaly[index]};
+}
+
+std::vector<OrbitalElements> OrbitalElementsColumns::getAoS() const {
+    std::vector<OrbitalElements> vector{};
+    vector.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        vector.push_back(getElement(i));
+    }
+    return vector;
+}
+
+void OrbitalElementsColumns::resize(size_t newSize) {
+    const size_t oldSize = this->size();
+    semiMajorAxis.resize(newSize);
+    eccentricity.resize(newSize);
+    inclination.resize(newSize);
+    longitudeOfTheAscendingNode.resize(newSize);
+    argumentOfPeriapsis.resize(newSize);
+    eccentricAnomaly.resize(newSize);
+
+    util::firstTouch(semiMajorAxis, oldSize);
+    util::firstTouch(eccentricity, oldSize);
+    util::firstTouch(inclination, oldSize);
+    util::firstTouch(longitudeOfTheAscendingNode, oldSize);
+    util::firstTouch(argumentOfPeriapsis, oldSize);
+    util::firstTouch(eccentricAnomaly, oldSize);
+}
+
+KeplerColumns KeplerColumns::fromCartesian(const Satellites &satellites) {
+    return fromElements(satellites.size(), [&](size_t i) {
+        return util::cartesianToKeplerian(satellites.getPosition(i), satellites.velocity[i]);
+    });
+}
+
+KeplerColumns KeplerColumns::fromCartesian(const std::vector<Satellite> &satelliteCollection) {
+    return fromElements(satelliteCollection.size(), [&](size_t i) {
+        //Only a cached value is read here, so the Satellites are not modified in parallel
+        const auto &satellite = satelliteCollection[i];
+        return satellite.hasOrbitalElementsCache() ? satellite.getOrbitalElements().getAsArray()
+                                                   : util::cartesianToKeplerian(satellite.getPosition(),
+                                                                                satellite.getVelocity());
+    });
+}
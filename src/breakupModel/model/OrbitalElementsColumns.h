@@ -0,0 +1,196 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <utility>
+#include <tuple>
+#include "OrbitalElements.h"
+#include "Satellites.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityMemory.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * This class implements the Orbital Elements of many objects (e.g. a fragment cloud) in an SoA (Structure of Array)
+ * way. Each of the six elements is saved in its own column, in the same order and with the same units like
+ * OrbitalElements::getAsArray().
+ * The conversions from and to the cartesian state are calculated in parallel over all elements.
+ * @note This class provides a method to copy the SoA structure into an AoS approach (std::vector<OrbitalElements>)
+ */
+class OrbitalElementsColumns {
+
+public:
+
+    /**
+     * The semi-major-axis of each object in [m]
+     */
+    util::ColumnVector<double> semiMajorAxis;
+
+    /**
+     * The eccentricity of each object (unit-less)
+     */
+    util::ColumnVector<double> eccentricity;
+
+    /**
+     * The inclination of each object in [rad]
+     */
+    util::ColumnVector<double> inclination;
+
+    /**
+     * The longitude-of-the-ascending-node (RAAN) of each object in [rad]
+     */
+    util::ColumnVector<double> longitudeOfTheAscendingNode;
+
+    /**
+     * The argument-of-periapsis of each object in [rad]
+     */
+    util::ColumnVector<double> argumentOfPeriapsis;
+
+    /**
+     * The eccentric anomaly (or the Gudermannian in the hyperbolic case) of each object in [rad]
+     */
+    util::ColumnVector<double> eccentricAnomaly;
+
+    OrbitalElementsColumns() = default;
+
+    explicit OrbitalElementsColumns(size_t size) {
+        this->resize(size);
+    }
+
+    /**
+     * Calculates the Orbital Elements of all satellites in the SoA from their cartesian position and velocity.
+     * The conversion runs in parallel and writes directly into the columns.
+     * @param satellites - the Satellites SoA (e.g. the fragments of a breakup)
+     * @return the Orbital Elements in the order of the satellites
+     */
+    static OrbitalElementsColumns fromCartesian(const Satellites &satellites);
+
+    /**
+     * Copies a vector of Orbital Elements (e.g. of a catalog) into the columns.
+     * @param orbitalElements - vector of OrbitalElements
+     * @return the Orbital Elements in the same order
+     */
+    static OrbitalElementsColumns fromAoS(const std::vector<OrbitalElements> &orbitalElements);
+
+    /**
+     * Calculates the cartesian position and velocity of all objects in parallel.
+     * The results are bit-identical to Satellite::setCartesianByOrbitalElements() since both use the same kernel.
+     * @return pair<positions [m], velocities [m/s]> in the order of the elements
+     */
+    [[nodiscard]] std::pair<util::ColumnVector<std::array<double, 3>>, util::ColumnVector<std::array<double, 3>>>
+    toCartesian() const;
+
+    /**
+     * Returns the Orbital Elements of one object.
+     * @param index - the index of the object
+     * @return OrbitalElements
+     */
+    [[nodiscard]] OrbitalElements getElement(size_t index) const;
+
+    /**
+     * Returns this Structure of Arrays as an Array of Structures.
+     * @return vector of OrbitalElements
+     */
+    [[nodiscard]] std::vector<OrbitalElements> getAoS() const;
+
+    /**
+     * Returns the size of this element.
+     * @return size
+     */
+    [[nodiscard]] size_t size() const {
+        return semiMajorAxis.size();
+    }
+
+    /**
+     * Resizes all columns to a new size.
+     * New elements are zero-initialized in parallel (first-touch), see util::firstTouch.
+     * @param newSize
+     */
+    void resize(size_t newSize);
+
+    /**
+     * Writes the elements of one object into the columns.
+     * @param index - the index of the object
+     * @param keplerianElements - array<a, e, i, W, w, eccentric-anomaly>
+     */
+    void setElement(size_t index, const std::array<double, 6> &keplerianElements) {
+        semiMajorAxis[index] = keplerianElements[0];
+        eccentricity[index] = keplerianElements[1];
+        inclination[index] = keplerianElements[2];
+        longitudeOfTheAscendingNode[index] = keplerianElements[3];
+        argumentOfPeriapsis[index] = keplerianElements[4];
+        eccentricAnomaly[index] = keplerianElements[5];
+    }
+
+};
+
+/**
+ * The Orbital Elements of many objects together with the mean and true anomaly columns.
+ * This is the representation needed by the output (e.g. CSVPatternWriter), all three anomaly variants are
+ * calculated once in the same parallel pass as the elements themselves.
+ * @note Satellites caches an instance of this lazily, see Satellites::getKeplerColumns()
+ */
+struct KeplerColumns {
+
+    /**
+     * The six Orbital Elements with the eccentric anomaly
+     */
+    OrbitalElementsColumns orbitalElements{};
+
+    /**
+     * The mean anomaly of each object in [rad]
+     */
+    util::ColumnVector<double> meanAnomaly{};
+
+    /**
+     * The true anomaly of each object in [rad]
+     */
+    util::ColumnVector<double> trueAnomaly{};
+
+    /**
+     * Calculates the Orbital Elements and anomalies of all satellites in the SoA from their cartesian state.
+     * @param satellites - the Satellites SoA
+     * @return KeplerColumns in the order of the satellites
+     */
+    static KeplerColumns fromCartesian(const Satellites &satellites);
+
+    /**
+     * Calculates the Orbital Elements and anomalies of all satellites in the vector. Cached Orbital Elements (e.g. the
+     * ones read from a TLE) are used as they are, the others are calculated from the cartesian state.
+     * The values are bit-identical to Satellite::getOrbitalElements().
+     * @param satelliteCollection - vector of Satellites
+     * @return KeplerColumns in the order of the satellites
+     */
+    static KeplerColumns fromCartesian(const std::vector<Satellite> &satelliteCollection);
+
+    /**
+     * Returns the size of this element.
+     * @return size
+     */
+    [[nodiscard]] size_t size() const {
+        return orbitalElements.size();
+    }
+
+private:
+
+    /**
+     * Fills the columns with the Orbital Elements given by the index-based accessor.
+     * @tparam ElementsOf - callable size_t -> array<a, e, i, W, w, EA>
+     * @param size - the number of objects
+     * @param elementsOf - the accessor to the Orbital Elements of one object
+     * @return KeplerColumns
+     */
+    template<typename ElementsOf>
+    static KeplerColumns fromElements(size_t size, ElementsOf elementsOf) {
+        KeplerColumns columns{OrbitalElementsColumns{size},
+                              util::ColumnVector<double>(size), util::ColumnVector<double>(size)};
+        util::forEachIndex(size, [&](size_t i) {
+            const std::array<double, 6> elements = elementsOf(i);
+            columns.orbitalElements.setElement(i, elements);
+            columns.meanAnomaly[i] = util::eccentricAnomalyToMeanAnomaly(elements[5], elements[1]);
+            columns.trueAnomaly[i] = util::eccentricAnomalyToTrueAnomaly(elements[5], elements[1]);
+        });
+        return columns;
+    }
+
+};
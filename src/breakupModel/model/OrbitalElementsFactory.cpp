@@ -6,6 +6,15 @@ OrbitalElements OrbitalElementsFactory::createFromTLEData(const std::array<doubl
     return createFromOnlyDegree(degKepler, OrbitalAnomalyType::MEAN, epoch);
 }
 
+std::vector<OrbitalElements> OrbitalElementsFactory::createFromTLEData(const std::vector<std::array<double, 6>> &tleData,
+                                                                      const std::vector<Epoch> &epochs) const {
+    std::vector<OrbitalElements> orbitalElements(tleData.size());
+    util::forEachIndex(tleData.size(), [&](size_t i) {
+        orbitalElements[i] = createFromTLEData(tleData[i], epochs[i]);
+    });
+    return orbitalElements;
+}
+
 OrbitalElements OrbitalElementsFactory::createFromOnlyRadians(const std::array<double, 6> &standardKepler,
                                                       OrbitalAnomalyType orbitalAnomalyType, const Epoch &epoch) const {
     double anomaly = standardKepler[5];
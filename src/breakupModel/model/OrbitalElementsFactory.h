@@ -2,6 +2,7 @@
 
 #include <utility>
 #include <tuple>
+#include <vector>
 #include "OrbitalElements.h"
 #include "breakupModel/util/UtilityKepler.h"
 #include "breakupModel/util/UtilityFunctions.h"
@@ -30,6 +31,16 @@ public:
     [[nodiscard]] OrbitalElements createFromTLEData(const std::array<double, 6> &tleData,
                                                     const Epoch &epoch = Epoch{}) const;
 
+    /**
+     * Constructs the Orbital Elements of many TLE entries at once (e.g. a whole catalog).
+     * The conversion runs in parallel and yields the same results as the single createFromTLEData().
+     * @param tleData - vector of arrays in the same order and units like the single createFromTLEData()
+     * @param epochs - the Epochs of these Elements, one per entry
+     * @return vector of OrbitalElements in the same order
+     */
+    [[nodiscard]] std::vector<OrbitalElements> createFromTLEData(const std::vector<std::array<double, 6>> &tleData,
+                                                                 const std::vector<Epoch> &epochs) const;
+
     /**
     * Constructs the Orbital Elements from the standard keplerian Elements in the following order:
     * @param keplerianElements array holds the arguments in the following order:<br>
@@ -0,0 +1,93 @@
+#include "OrbitalRegimeIndex.h"
+
+OrbitalRegimeIndex::OrbitalRegimeIndex(const Catalog &catalog) {
+    const size_t size = catalog.size();
+    std::vector<size_t> ids(catalog.id.cbegin(), catalog.id.cend());
+    std::vector<SatType> satTypes(catalog.satType.cbegin(), catalog.satType.cend());
+    if (catalog.hasOrbitalElements()) {
+        this->build(catalog.orbitalElements, ids, satTypes);
+    } else {
+        OrbitalElementsColumns elements{size};
+        util::forEachIndex(size, [&](size_t i) {
+            elements.setElement(i, util::cartesianToKeplerian(catalog.position[i], catalog.velocity[i]));
+        });
+        this->build(elements, ids, satTypes);
+    }
+}
+
+OrbitalRegimeIndex::OrbitalRegimeIndex(const std::vector<Satellite> &satellites) {
+    std::vector<size_t> ids(satellites.size());
+    std::vector<SatType> satTypes(satellites.size());
+    util::forEachIndex(satellites.size(), [&](size_t i) {
+        ids[i] = satellites[i].getId();
+        satTypes[i] = satellites[i].getSatType();
+    });
+    this->build(KeplerColumns::fromCartesian(satellites).orbitalElements, ids, satTypes);
+}
+
+std::vector<size_t> OrbitalRegimeIndex::find(const OrbitalRegimeQuery &query) const {
+    std::vector<size_t> positions{};
+    this->forEachMatch(query, [&](size_t entry) { positions.push_back(_positions[entry]); });
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+std::set<size_t> OrbitalRegimeIndex::findIDs(const OrbitalRegimeQuery &query) const {
+    std::set<size_t> ids{};
+    this->forEachMatch(query, [&](size_t entry) { ids.insert(_ids[entry]); });
+    return ids;
+}
+
+void OrbitalRegimeIndex::build(const OrbitalElementsColumns &elements, const std::vector<size_t> &ids,
+                               const std::vector<SatType> &satTypes) {
+    std::vector<double> perigeeAltitudes(elements.size());
+    std::vector<double> apogeeAltitudes(elements.size());
+    std::vector<size_t> buckets(elements.size());
+    std::vector<char> indexed(elements.size());
+    util::forEachIndex(elements.size(), [&](size_t i) {
+        //The semi-major-axis is positive, for hyperbolic orbits r_p = a (e - 1)
+        const double a = elements.semiMajorAxis[i];
+        const double e = elements.eccentricity[i];
+        perigeeAltitudes[i] = a * std::abs(1.0 - e) - util::EARTH_RADIUS;
+        apogeeAltitudes[i] = e < 1.0 ? a * (1.0 + e) - util::EARTH_RADIUS : std::numeric_limits<double>::infinity();
+        //Elements of a degenerate state (NaN) can neither be bucketed nor sorted
+        indexed[i] = std::isfinite(perigeeAltitudes[i]) && std::isfinite(elements.inclination[i]) &&
+                     !std::isnan(apogeeAltitudes[i]);
+        buckets[i] = indexed[i] ? bucketOf(elements.inclination[i]) : 0;
+    });
+
+    //Sort by bucket and perigee, the position keeps the order of equal keys deterministic
+    std::vector<size_t> order{};
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (indexed[i]) {
+            order.push_back(i);
+        }
+    }
+    const size_t size = order.size();
+    std::sort(std::execution::par_unseq, order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return std::tie(buckets[lhs], perigeeAltitudes[lhs], lhs) < std::tie(buckets[rhs], perigeeAltitudes[rhs], rhs);
+    });
+
+    _perigeeAltitudes.resize(size);
+    _apogeeAltitudes.resize(size);
+    _inclinations.resize(size);
+    _satTypes.resize(size);
+    _ids.resize(size);
+    _positions.resize(size);
+    util::forEachIndex(size, [&](size_t i) {
+        const size_t position = order[i];
+        _perigeeAltitudes[i] = perigeeAltitudes[position];
+        _apogeeAltitudes[i] = apogeeAltitudes[position];
+        _inclinations[i] = elements.inclination[position];
+        _satTypes[i] = satTypes[position];
+        _ids[i] = ids[position];
+        _positions[i] = position;
+    });
+
+    //The bucket boundaries
+    _offsets.assign(BUCKET_COUNT + 1, 0);
+    for (const size_t position : order) {
+        ++_offsets[buckets[position] + 1];
+    }
+    std::partial_sum(_offsets.cbegin(), _offsets.cend(), _offsets.begin());
+}
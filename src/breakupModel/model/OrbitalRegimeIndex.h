@@ -0,0 +1,195 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <set>
+#include <limits>
+#include <optional>
+#include <algorithm>
+#include <execution>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include "Satellite.h"
+#include "Catalog.h"
+#include "OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityFunctions.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityMemory.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * The bounds of a range query over an OrbitalRegimeIndex. Every bound is inclusive, unset bounds do not restrict the
+ * result. The altitudes are measured above util::EARTH_RADIUS.
+ */
+struct OrbitalRegimeQuery {
+
+    /**
+     * The range of the perigee altitude in [m]
+     */
+    double minimalPerigeeAltitude{-std::numeric_limits<double>::infinity()};
+    double maximalPerigeeAltitude{std::numeric_limits<double>::infinity()};
+
+    /**
+     * The range of the apogee altitude in [m] (infinite for hyperbolic orbits)
+     */
+    double minimalApogeeAltitude{-std::numeric_limits<double>::infinity()};
+    double maximalApogeeAltitude{std::numeric_limits<double>::infinity()};
+
+    /**
+     * The range of the inclination in [rad]
+     */
+    double minimalInclination{0.0};
+    double maximalInclination{util::PI};
+
+    /**
+     * If given only objects of this type are returned
+     */
+    std::optional<SatType> satType{std::nullopt};
+
+};
+
+/**
+ * Range index over the orbital regime (perigee, apogee, inclination) of the objects of a catalog, built once from
+ * their Orbital Elements. The objects are put into inclination buckets of one degree, inside a bucket they are sorted
+ * by their perigee altitude (CSR layout: one offset per bucket into flat columns). A query visits only the buckets
+ * which overlap its inclination range and finds the first candidate of a bucket with a binary search, so its cost
+ * depends on the number of objects in the queried regime and not on the size of the catalog.
+ * Objects with non-finite Orbital Elements (e.g. from a degenerate state vector) are not indexed.
+ */
+class OrbitalRegimeIndex {
+
+    /**
+     * The number of inclination buckets, one per degree over [0, pi]
+     */
+    static constexpr size_t BUCKET_COUNT = 180;
+
+    /**
+     * The entries of bucket b are [_offsets[b], _offsets[b + 1])
+     */
+    std::vector<size_t> _offsets{std::vector<size_t>(BUCKET_COUNT + 1, 0)};
+
+    /**
+     * The perigee altitude of each entry in [m] (the sort key inside a bucket)
+     */
+    util::ColumnVector<double> _perigeeAltitudes{};
+
+    /**
+     * The apogee altitude of each entry in [m]
+     */
+    util::ColumnVector<double> _apogeeAltitudes{};
+
+    /**
+     * The inclination of each entry in [rad]
+     */
+    util::ColumnVector<double> _inclinations{};
+
+    /**
+     * The SatType of each entry
+     */
+    util::ColumnVector<SatType> _satTypes{};
+
+    /**
+     * The ID of each entry
+     */
+    util::ColumnVector<size_t> _ids{};
+
+    /**
+     * The position of each entry in the indexed catalog or vector
+     */
+    util::ColumnVector<size_t> _positions{};
+
+public:
+
+    /**
+     * Creates an empty index.
+     */
+    OrbitalRegimeIndex() = default;
+
+    /**
+     * Builds the index over the objects of a catalog. A cartesian state is converted to Orbital Elements in parallel.
+     * @param catalog - the Catalog
+     */
+    explicit OrbitalRegimeIndex(const Catalog &catalog);
+
+    /**
+     * Builds the index over Satellites, their Orbital Elements are calculated in parallel (like KeplerColumns).
+     * @param satellites - vector of Satellites
+     */
+    explicit OrbitalRegimeIndex(const std::vector<Satellite> &satellites);
+
+    /**
+     * Returns the number of indexed objects (without the ones with non-finite Orbital Elements).
+     * @return size
+     */
+    [[nodiscard]] size_t size() const {
+        return _positions.size();
+    }
+
+    /**
+     * Returns the positions of the objects inside the regime.
+     * @param query - the bounds
+     * @return the positions in the indexed catalog or vector in ascending order
+     */
+    [[nodiscard]] std::vector<size_t> find(const OrbitalRegimeQuery &query) const;
+
+    /**
+     * Returns the IDs of the objects inside the regime, e.g. as ID filter of the BreakupBuilder.
+     * @param query - the bounds
+     * @return the IDs
+     */
+    [[nodiscard]] std::set<size_t> findIDs(const OrbitalRegimeQuery &query) const;
+
+private:
+
+    /**
+     * Sorts the objects into the buckets and fills the columns.
+     * @param elements - the Orbital Elements of the objects
+     * @param ids - the ID of each object
+     * @param satTypes - the SatType of each object
+     */
+    void build(const OrbitalElementsColumns &elements, const std::vector<size_t> &ids,
+               const std::vector<SatType> &satTypes);
+
+    /**
+     * Calls the visitor with the entry index of every object inside the regime.
+     * @tparam Visitor - callable size_t -> void
+     * @param query - the bounds
+     * @param visitor - called for every matching entry
+     */
+    template<typename Visitor>
+    void forEachMatch(const OrbitalRegimeQuery &query, Visitor visitor) const {
+        //Also rejects a NaN bound
+        if (!(query.minimalInclination <= query.maximalInclination)) {
+            return;
+        }
+        const size_t firstBucket = bucketOf(query.minimalInclination);
+        const size_t lastBucket = bucketOf(query.maximalInclination);
+        for (size_t bucket = firstBucket; bucket <= lastBucket; ++bucket) {
+            const auto begin = std::next(_perigeeAltitudes.cbegin(), static_cast<std::ptrdiff_t>(_offsets[bucket]));
+            const auto end = std::next(_perigeeAltitudes.cbegin(), static_cast<std::ptrdiff_t>(_offsets[bucket + 1]));
+            for (auto it = std::lower_bound(begin, end, query.minimalPerigeeAltitude);
+                 it != end && *it <= query.maximalPerigeeAltitude; ++it) {
+                const auto entry = static_cast<size_t>(std::distance(_perigeeAltitudes.cbegin(), it));
+                if (_inclinations[entry] >= query.minimalInclination &&
+                    _inclinations[entry] <= query.maximalInclination &&
+                    _apogeeAltitudes[entry] >= query.minimalApogeeAltitude &&
+                    _apogeeAltitudes[entry] <= query.maximalApogeeAltitude &&
+                    (!query.satType.has_value() || _satTypes[entry] == query.satType.value())) {
+                    visitor(entry);
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the bucket of an inclination (clamped to [0, pi]).
+     * @param inclination - in [rad], must not be NaN
+     * @return bucket index
+     */
+    static size_t bucketOf(double inclination) {
+        const double bucket = std::floor(inclination / util::PI * static_cast<double>(BUCKET_COUNT));
+        return static_cast<size_t>(std::clamp(bucket, 0.0, static_cast<double>(BUCKET_COUNT - 1)));
+    }
+
+};
@@ -185,16 +185,37 @@ public:
      */
     void setCartesianByOrbitalElements(const OrbitalElements &orbitalElements);
 
+    /**
+     * Sets the cartesian velocity and cartesian position of this satellite to an already calculated state which
+     * belongs to the given Keplerian Elements (e.g. from the batch conversion of OrbitalElementsColumns).
+     * @param orbitalElements holds the Keplerian Elements
+     * @param position - the cartesian position corresponding to the Keplerian Elements
+     * @param velocity - the cartesian velocity corresponding to the Keplerian Elements
+     * @note This method will also sets the value of the _orbitalElementsCache
+     */
+    void setCartesianByOrbitalElements(const OrbitalElements &orbitalElements, const std::array<double, 3> &position,
+                                       const std::array<double, 3> &velocity);
+
     /**
      * Calculates the Keplerian Elements by using the satellite's caretsian position and velocity vectors.
      * @return the Orbital Elements
      * @note This method will return the value of the cache _orbitalElementsCache if valid otherwise it will calculate
      * the value and saves them to the cache for further use
+     * @note The cache is not thread-safe. For the conversion of many satellites/ fragments use the parallel batch
+     * conversion of OrbitalElementsColumns instead
      * @related Code taken and adapted from pykep
      * (https://github.com/esa/pykep/blob/master/include/keplerian_toolbox/core_functions/ic2par.hpp) [25.06.2021]
      */
     OrbitalElements getOrbitalElements() const;
 
+    /**
+     * Returns true if the Orbital Elements are cached, i.e. getOrbitalElements() returns them without a conversion.
+     * @return true if cached
+     */
+    [[nodiscard]] bool hasOrbitalElementsCache() const {
+        return _orbitalElementsCache.has_value();
+    }
+
     /**
      * Compares two Satellites by comparing their IDs.
      * @param lhs - Satellite
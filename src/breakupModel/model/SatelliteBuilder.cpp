@@ -93,6 +93,15 @@ SatelliteBuilder &SatelliteBuilder::setOrbitalElements(const OrbitalElements &or
     return *this;
 }
 
+SatelliteBuilder &SatelliteBuilder::setOrbitalElements(const OrbitalElements &orbitalElements,
+                                                       const std::array<double, 3> &position,
+                                                       const std::array<double, 3> &velocity) {
+    _hasVelocity = true;
+    _hasPosition = true;
+    _satellite.setCartesianByOrbitalElements(orbitalElements, position, velocity);
+    return *this;
+}
+
 Satellite &SatelliteBuilder::getResult() {
     if (!_hasID) {
         std::stringstream message{};
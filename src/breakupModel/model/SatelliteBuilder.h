@@ -137,6 +137,19 @@ public:
      */
     SatelliteBuilder &setOrbitalElements(const OrbitalElements &orbitalElements);
 
+    /**
+     * Sets the position and velocity of the satellite to an already calculated state which belongs to the given
+     * Keplerian Elements (e.g. from the batch conversion of OrbitalElementsColumns::toCartesian()).
+     * @param orbitalElements holds the Keplerian Elements
+     * @param position - the cartesian position corresponding to the Keplerian Elements
+     * @param velocity - the cartesian velocity corresponding to the Keplerian Elements
+     * @return this
+     * @attention This will override previous attempts of setting the velocity/ position.
+     */
+    SatelliteBuilder &setOrbitalElements(const OrbitalElements &orbitalElements,
+                                         const std::array<double, 3> &position,
+                                         const std::array<double, 3> &velocity);
+
     /**
      * Returns the fully build satellite. Validates if all necessary parameters are specified.
      * @return Satellite
@@ -1,4 +1,5 @@
 #include "Satellites.h"
+#include "OrbitalElementsColumns.h"
 
 std::vector<std::tuple<double &, std::array<double, 3> &, std::array<double, 3> &>> Satellites::getVelocityTuple() {
     std::vector<std::tuple<double &, std::array<double, 3> &, std::array<double, 3> &>> vector{};
@@ -43,20 +44,27 @@ std::vector<Satellite> Satellites::getAoS() const {
     size_t id = startId;
     vector.reserve(size);
 
-    auto nameIt = name.begin();
-    auto lcIt = characteristicLength.begin();
-    auto amIt = areaToMassRatio.begin();
-    auto mIt = mass.begin();
-    auto aIt = area.begin();
-    auto vIt = velocity.begin();
-    auto evIt = ejectionVelocity.begin();
-
-    for (; lcIt != characteristicLength.end(); ++nameIt, ++lcIt, ++amIt, ++mIt, ++aIt, ++vIt, ++evIt) {
-        vector.emplace_back(id++, *nameIt, satType, *lcIt, *amIt, *mIt, *aIt, *vIt, *evIt, position);
+    //The position is either the shared base position or the individual one of the fragment
+    for (size_t i = 0; i < size; ++i) {
+        vector.emplace_back(id++, name[i], satType, characteristicLength[i], areaToMassRatio[i], mass[i], area[i],
+                            velocity[i], ejectionVelocity[i], getPosition(i));
     }
     return vector;
 }
 
+std::shared_ptr<const KeplerColumns> Satellites::getKeplerColumns() const {
+    auto keplerColumns = std::atomic_load(&_keplerColumns);
+    if (!keplerColumns) {
+        std::shared_ptr<const KeplerColumns> calculated =
+                std::make_shared<const KeplerColumns>(KeplerColumns::fromCartesian(*this));
+        //If another thread was faster, expected contains its result which is then used instead
+        std::shared_ptr<const KeplerColumns> expected{};
+        keplerColumns = std::atomic_compare_exchange_strong(&_keplerColumns, &expected, calculated)
+                        ? calculated : expected;
+    }
+    return keplerColumns;
+}
+
 void Satellites::popBack() {
     this->resize(this->size() - 1);
 }
@@ -77,6 +85,9 @@ std::tuple<double &, double &, double &, double &> Satellites::prependElement()
     std::swap(area.front(), area.back());
     std::swap(ejectionVelocity.front(), ejectionVelocity.back());
     std::swap(velocity.front(), velocity.back());
+    if (hasFragmentPositions()) {
+        std::swap(fragmentPosition.front(), fragmentPosition.back());
+    }
 
     return std::tuple<double &, double &, double &, double &>
             {characteristicLength.front(), areaToMassRatio.front(), area.front(), mass.front()};
@@ -6,14 +6,22 @@
 #include <tuple>
 #include <algorithm>
 #include <memory>
+#include <atomic>
 
 #include "Satellite.h"
+#include "breakupModel/util/UtilityMemory.h"
+
+struct KeplerColumns;
 
 /**
  * This class implements the Satellites in an SoA (Structure of Array) way.
  * This is especially useful for the BreakupSimulation to vectorized calculation and save memory for shared
  * properties of the fragment satellites created.
  * @note This class provides a method to copy the SoA structure into an AoS approach (std::vector<Satellite>)
+ * @note The columns use the util::memory::FirstTouchAllocator, so their pages are placed by the parallel first-touch
+ * in resize() and not by the allocating thread (NUMA awareness)
+ * @note The Orbital Elements are calculated lazily (once) on the first call of getKeplerColumns(), after directly
+ * writing to the velocity or position columns invalidateKeplerColumns() needs to be called
  */
 class Satellites {
 
@@ -37,6 +45,7 @@ public:
     /**
      * The position base of the Satellites in the SoA
      * This is a cartesian position vector in [m]
+     * @note Only valid for all Satellites as long as no fragmentPosition column is active
      */
     std::array<double, 3> position{};
 
@@ -47,39 +56,57 @@ public:
     /**
      * The name of each of the Satellites in the SoA
      */
-    std::vector<std::shared_ptr<const std::string>> name;
+    util::ColumnVector<std::shared_ptr<const std::string>> name;
 
     /**
      * The characteristic length of each satellite in [m]
      */
-    std::vector<double> characteristicLength;
+    util::ColumnVector<double> characteristicLength;
 
     /**
      * The area-to-mass ratio of each satellite in [m^2/kg]
      */
-    std::vector<double> areaToMassRatio;
+    util::ColumnVector<double> areaToMassRatio;
 
     /**
      * The mass of each satellite in [kg]
      */
-    std::vector<double> mass;
+    util::ColumnVector<double> mass;
 
     /**
      * The area/ Radar-Cross-Section of each satellite in [m^2]
      */
-    std::vector<double> area;
+    util::ColumnVector<double> area;
 
     /**
      * The ejection velocity of each satellite in [m/s]
      * This is a cartesian velocity vector.
      */
-    std::vector<std::array<double, 3>> ejectionVelocity;
+    util::ColumnVector<std::array<double, 3>> ejectionVelocity;
 
     /**
      * The velocity of each satellite in [m/s]
      * This is a cartesian velocity vector in which each element is the sum of ejection and (parental) base velocity
      */
-    std::vector<std::array<double, 3>> velocity;
+    util::ColumnVector<std::array<double, 3>> velocity;
+
+    /**
+     * The individual position of each satellite in [m] (optional)
+     * This column is empty by default (all Satellites share the base position) and is only allocated by
+     * materializeFragmentPositions() when the positions diverge, e.g. because of a propagation.
+     * Use getPosition(i) to read the position of a satellite independent of the active representation.
+     */
+    util::ColumnVector<std::array<double, 3>> fragmentPosition;
+
+private:
+
+    /**
+     * The lazily calculated Orbital Elements of the Satellites, nullptr as long as nobody requested them.
+     * Only accessed with the atomic shared_ptr operations, so concurrent readers are allowed.
+     */
+    mutable std::shared_ptr<const KeplerColumns> _keplerColumns{};
+
+public:
 
     Satellites() = default;
 
@@ -124,6 +151,50 @@ public:
     */
     std::vector<std::tuple<std::array<double, 3> &, std::shared_ptr<const std::string> &>> getVNTuple();
 
+    /**
+     * Returns true if each satellite has its own position (fragmentPosition column is active).
+     * @return true if the fragmentPosition column is used
+     */
+    bool hasFragmentPositions() const {
+        return !fragmentPosition.empty();
+    }
+
+    /**
+     * Allocates the fragmentPosition column and initializes every element with the shared base position.
+     * Does nothing if the column is already active.
+     */
+    void materializeFragmentPositions() {
+        if (!hasFragmentPositions() && size() > 0) {
+            fragmentPosition.resize(size());
+            util::firstTouch(fragmentPosition, 0, position);
+        }
+    }
+
+    /**
+     * Returns the position of one satellite, either its own or the shared base position.
+     * @param index - the index of the satellite
+     * @return cartesian position in [m]
+     */
+    const std::array<double, 3> &getPosition(size_t index) const {
+        return hasFragmentPositions() ? fragmentPosition[index] : position;
+    }
+
+    /**
+     * Returns the Orbital Elements and all three anomalies of the Satellites.
+     * They are calculated in one parallel batch on the first call and cached afterwards, so consumers like the
+     * output writers share the result instead of converting the cartesian state for every satellite and column.
+     * @return shared_ptr to the KeplerColumns in the order of the satellites
+     * @note thread-safe, if two threads race both calculate the columns but the same result is kept
+     */
+    std::shared_ptr<const KeplerColumns> getKeplerColumns() const;
+
+    /**
+     * Discards the cached Orbital Elements, needs to be called after the cartesian state was changed directly.
+     */
+    void invalidateKeplerColumns() {
+        std::atomic_store(&_keplerColumns, std::shared_ptr<const KeplerColumns>{});
+    }
+
     /**
      * Returns the size of this element.
      * @return size
@@ -134,9 +205,12 @@ public:
 
     /**
      * Resizes the Satellites SoA to a new size.
+     * New elements are zero-initialized in parallel (first-touch), see util::firstTouch.
      * @param newSize
      */
     void resize(size_t newSize) {
+        const size_t oldSize = this->size();
+        invalidateKeplerColumns();
         name.resize(newSize);
         characteristicLength.resize(newSize);
         areaToMassRatio.resize(newSize);
@@ -144,6 +218,50 @@ public:
         area.resize(newSize);
         ejectionVelocity.resize(newSize);
         velocity.resize(newSize);
+        if (hasFragmentPositions()) {
+            fragmentPosition.resize(newSize);
+            util::firstTouch(fragmentPosition, oldSize, position);
+        }
+
+        util::firstTouch(characteristicLength, oldSize);
+        util::firstTouch(areaToMassRatio, oldSize);
+        util::firstTouch(mass, oldSize);
+        util::firstTouch(area, oldSize);
+        util::firstTouch(ejectionVelocity, oldSize);
+        util::firstTouch(velocity, oldSize);
+    }
+
+    /**
+     * Removes all elements for which the predicate returns true. The order of the remaining elements is kept
+     * (stable compaction of all columns).
+     * @tparam Predicate - callable size_t index -> bool
+     * @param removed - the predicate which gets the index of an element and returns true if it should be removed
+     * @return the number of removed elements
+     */
+    template<typename Predicate>
+    size_t removeIf(Predicate removed) {
+        const size_t oldSize = this->size();
+        size_t newSize = 0;
+        for (size_t i = 0; i < oldSize; ++i) {
+            if (removed(i)) {
+                continue;
+            }
+            if (newSize != i) {
+                name[newSize] = std::move(name[i]);
+                characteristicLength[newSize] = characteristicLength[i];
+                areaToMassRatio[newSize] = areaToMassRatio[i];
+                mass[newSize] = mass[i];
+                area[newSize] = area[i];
+                ejectionVelocity[newSize] = ejectionVelocity[i];
+                velocity[newSize] = velocity[i];
+                if (hasFragmentPositions()) {
+                    fragmentPosition[newSize] = fragmentPosition[i];
+                }
+            }
+            ++newSize;
+        }
+        this->resize(newSize);
+        return oldSize - newSize;
     }
 
     /**
@@ -1,52 +1,67 @@
 #include "CSVPatternWriter.h"
 
-const std::map<char, std::function<void(const Satellite &sat,
-                                        std::stringstream &stream)>> CSVPatternWriter::functionMap{
-        {'I', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getId(); }},
-        {'n', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getName(); }},
-        {'t', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getSatType(); }},
-        {'L', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getCharacteristicLength(); }},
-        {'R', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getAreaToMassRatio(); }},
-        {'A', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getArea(); }},
-        {'m', [](const Satellite &sat, std::stringstream &stream) -> void { stream << sat.getMass(); }},
-        {'v', [](const Satellite &sat, std::stringstream &stream) -> void {
+const std::map<char, CSVPatternWriter::PrintFunction> CSVPatternWriter::functionMap{
+        {'I', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
+            stream << sat.getId();
+        }},
+        {'n', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
+            stream << sat.getName();
+        }},
+        {'t', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
+            stream << sat.getSatType();
+        }},
+        {'L', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
+            stream << sat.getCharacteristicLength();
+        }},
+        {'R', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
+            stream << sat.getAreaToMassRatio();
+        }},
+        {'A', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
+            stream << sat.getArea();
+        }},
+        {'m', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
+            stream << sat.getMass();
+        }},
+        {'v', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
             using util::operator<<;
             stream << sat.getVelocity();
         }},
-        {'j', [](const Satellite &sat, std::stringstream &stream) -> void {
+        {'j', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
             using util::operator<<;
             stream << sat.getEjectionVelocity();
         }},
-        {'p', [](const Satellite &sat, std::stringstream &stream) -> void {
+        {'p', [](const Satellite &sat, const KeplerColumns &, size_t, std::stringstream &stream) -> void {
             using util::operator<<;
             stream << sat.getPosition();
         }},
-        {'a', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getSemiMajorAxis();
+        {'a', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.orbitalElements.semiMajorAxis[index];
         }},
-        {'e', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getEccentricity();
+        {'e', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.orbitalElements.eccentricity[index];
         }},
-        {'i', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getInclination(AngularUnit::RADIAN);
+        {'i', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.orbitalElements.inclination[index];
         }},
-        {'W', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getLongitudeOfTheAscendingNode(AngularUnit::RADIAN);
+        {'W', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.orbitalElements.longitudeOfTheAscendingNode[index];
         }},
-        {'w', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getArgumentOfPeriapsis(AngularUnit::RADIAN);
+        {'w', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.orbitalElements.argumentOfPeriapsis[index];
         }},
-        {'M', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::MEAN);
+        {'M', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.meanAnomaly[index];
         }},
-        {'E', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::ECCENTRIC);
+        {'E', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.orbitalElements.eccentricAnomaly[index];
         }},
-        {'T', [](const Satellite &sat, std::stringstream &stream) -> void {
-            stream << sat.getOrbitalElements().getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::TRUE);
+        {'T', [](const Satellite &, const KeplerColumns &kepler, size_t index, std::stringstream &stream) -> void {
+            stream << kepler.trueAnomaly[index];
         }}
 };
 
+const std::string CSVPatternWriter::keplerChars{"aeiWwMET"};
+
 const std::map<char, std::string> CSVPatternWriter::headerMap{
         {'I', "ID"},
         {'n', "Name"},
@@ -69,6 +84,20 @@ const std::map<char, std::string> CSVPatternWriter::headerMap{
 };
 
 void CSVPatternWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
+    this->printResult(satelliteCollection,
+                      _withKepler ? KeplerColumns::fromCartesian(satelliteCollection) : KeplerColumns{});
+}
+
+void CSVPatternWriter::printResult(const Satellites &satellites) const {
+    if (_withKepler) {
+        this->printResult(satellites.getAoS(), *satellites.getKeplerColumns());
+    } else {
+        this->printResult(satellites.getAoS(), KeplerColumns{});
+    }
+}
+
+void CSVPatternWriter::printResult(const std::vector<Satellite> &satelliteCollection,
+                                   const KeplerColumns &keplerColumns) const {
     //Header
     std::stringstream header{};
     for (auto headerIt = _myHeader.begin(); headerIt != _myHeader.end() - 1; ++headerIt) {
@@ -78,14 +107,14 @@ void CSVPatternWriter::printResult(const std::vector<Satellite> &satelliteCollec
     _logger->info(header.str());
 
     //CSV Lines
-    for (const auto &sat : satelliteCollection) {
+    for (size_t i = 0; i < satelliteCollection.size(); ++i) {
         std::stringstream stream{};
         stream.precision(17);
         for (auto funIt = _myToDo.begin(); funIt != _myToDo.end() - 1; ++funIt) {
-            (*funIt)(sat, stream);
+            (*funIt)(satelliteCollection[i], keplerColumns, i, stream);
             stream << ',';
         }
-        _myToDo.back()(sat, stream);
+        _myToDo.back()(satelliteCollection[i], keplerColumns, i, stream);
         _logger->info(stream.str());
     }
 }
@@ -10,6 +10,8 @@
 #include <map>
 #include <functional>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
 #include "breakupModel/util/UtilityContainer.h"
 #include "spdlog/async.h"
 #include "spdlog/sinks/basic_file_sink.h"
@@ -32,11 +34,23 @@
  */
 class CSVPatternWriter : public OutputWriter {
 
+    /**
+     * Prints one attribute of the satellite with the given index. The Orbital Elements are read from the KeplerColumns
+     * (which are empty if the pattern contains no Kepler char).
+     */
+    using PrintFunction = std::function<void(const Satellite &sat, const KeplerColumns &kepler, size_t index,
+                                             std::stringstream &stream)>;
+
     /**
      * Map which contains all available functions for a specific char. Those functions are usually getter of Satellite.
      * @example for 'A' --> satellite.getArea()
      */
-    const static std::map<char, std::function<void(const Satellite &sat, std::stringstream &stream)>> functionMap;
+    const static std::map<char, PrintFunction> functionMap;
+
+    /**
+     * The chars of the pattern which need the Orbital Elements.
+     */
+    const static std::string keplerChars;
 
     /**
      * Map which contains all available names for a specific char.
@@ -48,7 +62,7 @@ class CSVPatternWriter : public OutputWriter {
      * Contains the functions to execute for each satellite print. We iterate over the whole vector and execute
      * the functions for each satellite.
      */
-    std::vector<std::function<void(const Satellite &sat, std::stringstream &stream)>> _myToDo;
+    std::vector<PrintFunction> _myToDo;
 
     /**
      * Contains the Header information, which is printed by iterating over the whole vector and printing the strings
@@ -56,6 +70,11 @@ class CSVPatternWriter : public OutputWriter {
      */
     std::vector<std::string> _myHeader;
 
+    /**
+     * True if the pattern contains at least one char which needs the Orbital Elements
+     */
+    bool _withKepler{false};
+
     /**
      * The logger which is needed to write to a file sink
      */
@@ -75,6 +94,7 @@ public:
         for (char c : pattern) {
             _myToDo.push_back(functionMap.at(c));
             _myHeader.push_back(headerMap.at(c));
+            _withKepler |= keplerChars.find(c) != std::string::npos;
         }
     }
 
@@ -91,6 +111,7 @@ public:
         for (char c : pattern) {
             _myToDo.push_back(functionMap.at(c));
             _myHeader.push_back(headerMap.at(c));
+            _withKepler |= keplerChars.find(c) != std::string::npos;
         }
     }
 
@@ -102,6 +123,23 @@ public:
         spdlog::drop(_logger->name());
     }
 
+    using OutputWriter::printResult;
+
     void printResult(const std::vector<Satellite> &satelliteCollection) const override;
 
+    /**
+     * Prints the Satellites SoA, the Orbital Elements are taken from the columns cached in the SoA.
+     * @param satellites
+     */
+    void printResult(const Satellites &satellites) const override;
+
+private:
+
+    /**
+     * Prints the satellites with the given Orbital Elements.
+     * @param satelliteCollection - vector of Satellites
+     * @param keplerColumns - the Orbital Elements of the satellites (same order), may be empty if not _withKepler
+     */
+    void printResult(const std::vector<Satellite> &satelliteCollection, const KeplerColumns &keplerColumns) const;
+
 };
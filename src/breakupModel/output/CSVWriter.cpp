@@ -2,12 +2,20 @@
 
 void CSVWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
     if (_withKepler) {
-        this->printKepler(satelliteCollection);
+        this->printKepler(satelliteCollection, KeplerColumns::fromCartesian(satelliteCollection));
     } else {
         this->printStandard(satelliteCollection);
     }
 }
 
+void CSVWriter::printResult(const Satellites &satellites) const {
+    if (_withKepler) {
+        this->printKepler(satellites.getAoS(), *satellites.getKeplerColumns());
+    } else {
+        this->printStandard(satellites.getAoS());
+    }
+}
+
 void CSVWriter::printStandard(const std::vector<Satellite> &satelliteCollection) const {
     _logger->info(
             "ID,Name,Satellite Type,Characteristic Length [m],A/M [m^2/kg],Area [m^2],Mass [kg],"
@@ -24,22 +32,26 @@ void CSVWriter::printStandard(const std::vector<Satellite> &satelliteCollection)
     }
 }
 
-void CSVWriter::printKepler(const std::vector<Satellite> &satelliteCollection) const {
+void CSVWriter::printKepler(const std::vector<Satellite> &satelliteCollection,
+                            const KeplerColumns &keplerColumns) const {
     _logger->info("ID,Name,Satellite Type,Characteristic Length [m],A/M [m^2/kg],Area [m^2],Mass [kg],"
                   "Ejection Velocity [m/s],Velocity [m/s],Position [m],"
                   "Semi-Major-Axis [m],Eccentricity,Inclination [rad],Longitude of the ascending node [rad],"
                   "Argument of periapsis [rad],Mean Anomaly [rad]");
-    for (const auto &sat : satelliteCollection) {
+    const auto &kepler = keplerColumns.orbitalElements;
+    for (size_t i = 0; i < satelliteCollection.size(); ++i) {
+        const auto &sat = satelliteCollection[i];
         auto &j = sat.getEjectionVelocity();
         auto &v = sat.getVelocity();
         auto &p = sat.getPosition();
-        auto kepler = sat.getOrbitalElements();
         //Because of ADL the overload operator<< for arrays (in UtilityContainer) does not work here
         //@related https://en.cppreference.com/w/cpp/language/adl
         _logger->info("{},{},{},{},{},{},{},[{} {} {}],[{} {} {}],[{} {} {}],{},{},{},{},{},{}", sat.getId(), sat.getName(), sat.getSatType(),
                       sat.getCharacteristicLength(), sat.getAreaToMassRatio(), sat.getArea(), sat.getMass(),
                       j[0], j[1], j[2], v[0], v[1], v[2], p[0], p[1], p[2],
-                      kepler[0], kepler[1], kepler[2], kepler[3], kepler[4], kepler[5]);
+                      kepler.semiMajorAxis[i], kepler.eccentricity[i], kepler.inclination[i],
+                      kepler.longitudeOfTheAscendingNode[i], kepler.argumentOfPeriapsis[i],
+                      kepler.eccentricAnomaly[i]);
     }
 }
 
@@ -8,6 +8,8 @@
 #include <utility>
 #include <memory>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
 #include "breakupModel/util/UtilityContainer.h"
 #include "spdlog/async.h"
 #include "spdlog/sinks/basic_file_sink.h"
@@ -70,8 +72,16 @@ public:
         spdlog::drop(_logger->name());
     }
 
+    using OutputWriter::printResult;
+
     void printResult(const std::vector<Satellite> &satelliteCollection) const override;
 
+    /**
+     * Prints the Satellites SoA, the Kepler elements are taken from the columns cached in the SoA.
+     * @param satellites
+     */
+    void printResult(const Satellites &satellites) const override;
+
 private:
 
     /**
@@ -83,8 +93,9 @@ private:
     /**
      * Prints the vector with Kepler elements.
      * @param satelliteCollection
+     * @param keplerColumns - the Orbital Elements of the satellites (same order)
      */
-    void printKepler(const std::vector<Satellite> &satelliteCollection) const;
+    void printKepler(const std::vector<Satellite> &satelliteCollection, const KeplerColumns &keplerColumns) const;
 
 };
 
@@ -0,0 +1,103 @@
+#include "DensityGridWriter.h"
+
+void DensityGridWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
+    this->write(this->createGrid(satelliteCollection));
+}
+
+void DensityGridWriter::printResult(const Satellites &satellites) const {
+    this->write(this->createGrid(satellites));
+}
+
+util::Grid3D DensityGridWriter::createGrid(const std::vector<Satellite> &satelliteCollection) const {
+    return this->createGrid(KeplerColumns::fromCartesian(satelliteCollection));
+}
+
+util::Grid3D DensityGridWriter::createGrid(const Satellites &satellites) const {
+    return this->createGrid(*satellites.getKeplerColumns());
+}
+
+util::Grid3D DensityGridWriter::createGrid(const KeplerColumns &keplerColumns) const {
+    static constexpr double earthRadius = util::EARTH_RADIUS / 1000.0;
+    const auto &elements = keplerColumns.orbitalElements;
+    const size_t altitudeBins = _prototype.getBins(0);
+    const double minAltitude = _prototype.getRange(0)[0];
+    const double maxAltitude = _prototype.getRange(0)[1];
+
+    //Volume of each altitude shell in [km^3]
+    std::vector<double> shellVolume(altitudeBins);
+    for (size_t k = 0; k < altitudeBins; ++k) {
+        const double inner = earthRadius + _prototype.getLowerEdge(0, k);
+        const double outer = earthRadius + _prototype.getLowerEdge(0, k + 1);
+        shellVolume[k] = 4.0 / 3.0 * util::PI * (outer * outer * outer - inner * inner * inner);
+    }
+
+    return util::buildParallel(_prototype, keplerColumns.size(), [&](size_t i, util::Grid3D &local) {
+        const double a = elements.semiMajorAxis[i] / 1000.0;
+        const double e = elements.eccentricity[i];
+        const size_t inclination = local.getBinIndex(1, util::radToDeg(elements.inclination[i]));
+        const size_t raan = local.getBinIndex(2, util::radToDeg(elements.longitudeOfTheAscendingNode[i]));
+        //Hyperbolic and out of range fragments do not contribute
+        if (!(e < 1.0) || inclination == local.getBins(1) || raan == local.getBins(2)) {
+            return;
+        }
+        const double perigee = a * (1.0 - e) - earthRadius;
+        const double apogee = a * (1.0 + e) - earthRadius;
+        if (apogee < minAltitude || perigee >= maxAltitude) {
+            return;
+        }
+
+        //(Nearly) circular orbits stay the whole period in one shell
+        if (apogee - perigee < 1e-9) {
+            const size_t shell = local.getBinIndex(0, a - earthRadius);
+            if (shell < altitudeBins) {
+                local.add(shell, inclination, raan, 1.0 / shellVolume[shell]);
+            }
+            return;
+        }
+
+        //Fraction of the period between perigee and the radius r, using the mean anomaly in [0, pi]
+        auto periodFraction = [a, e](double r) {
+            const double eccentricAnomaly = std::acos(std::clamp((1.0 - r / a) / e, -1.0, 1.0));
+            return (eccentricAnomaly - e * std::sin(eccentricAnomaly)) / util::PI;
+        };
+        const size_t first = perigee < minAltitude ? 0 : local.getBinIndex(0, perigee);
+        const size_t last = apogee >= maxAltitude ? altitudeBins - 1 : local.getBinIndex(0, apogee);
+        for (size_t k = first; k <= last; ++k) {
+            const double lower = std::max(earthRadius + local.getLowerEdge(0, k), a * (1.0 - e));
+            const double upper = std::min(earthRadius + local.getLowerEdge(0, k + 1), a * (1.0 + e));
+            local.add(k, inclination, raan, (periodFraction(upper) - periodFraction(lower)) / shellVolume[k]);
+        }
+    });
+}
+
+void DensityGridWriter::write(const util::Grid3D &grid) const {
+    const std::string ending = _filename.substr(_filename.size() - std::min(_filename.size(), size_t{3}));
+    if (ending != "csv" && ending != "npy") {
+        throw std::runtime_error{"The density grid " + _filename + " can only be written as csv or npy!"};
+    }
+    std::ofstream file{_filename, ending == "npy" ? std::ios::out | std::ios::binary : std::ios::out};
+    if (!file) {
+        throw std::runtime_error{"The density grid file " + _filename + " could not be opened!"};
+    }
+
+    if (ending == "npy") {
+        util::writeNpy(file, grid.getValues().data(), {grid.getBins(0), grid.getBins(1), grid.getBins(2)});
+        return;
+    }
+    file.precision(17);
+    file << "Altitude lower [km],Altitude upper [km],Inclination lower [deg],Inclination upper [deg],"
+            "RAAN lower [deg],RAAN upper [deg],Density [1/km^3]\n";
+    for (size_t i = 0; i < grid.getBins(0); ++i) {
+        for (size_t j = 0; j < grid.getBins(1); ++j) {
+            for (size_t k = 0; k < grid.getBins(2); ++k) {
+                const double density = grid.getValue(i, j, k);
+                if (density == 0.0) {
+                    continue;
+                }
+                file << grid.getLowerEdge(0, i) << ',' << grid.getLowerEdge(0, i + 1) << ','
+                     << grid.getLowerEdge(1, j) << ',' << grid.getLowerEdge(1, j + 1) << ','
+                     << grid.getLowerEdge(2, k) << ',' << grid.getLowerEdge(2, k + 1) << ',' << density << '\n';
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "OutputWriter.h"
+
+#include <array>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cmath>
+#include <stdexcept>
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityHistogram.h"
+#include "breakupModel/util/UtilityFunctions.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityNpy.h"
+#include "spdlog/spdlog.h"
+
+/**
+ * Analysis sink which calculates the contribution of the fragment cloud to the spatial density, binned by
+ * altitude shell [km] x inclination [deg] x RAAN [deg].
+ * The density is time-averaged over one orbit: each fragment is spread over the altitude shells between its perigee
+ * and apogee according to the fraction of the orbital period it spends in the shell (Kepler's equation), divided by
+ * the volume of the shell. Thus the unit of the grid is [1/km^3]. Hyperbolic fragments do not contribute.
+ * The result is written either as sparse CSV (only bins with a value > 0, with the bin edges) or as dense NPY array
+ * with the shape (altitude bins, inclination bins, RAAN bins). The format is chosen by the file ending (.csv or .npy).
+ */
+class DensityGridWriter : public OutputWriter {
+
+    /**
+     * The target file
+     */
+    std::string _filename;
+
+    /**
+     * Defines the bins of the grid (altitude [km], inclination [deg], RAAN [deg])
+     */
+    util::Grid3D _prototype;
+
+public:
+
+    /**
+     * Default ranges: altitude [200, 2000[ km, inclination [0, 180[ deg, RAAN [0, 360[ deg
+     */
+    static constexpr std::array<std::array<double, 2>, 3> DEFAULT_RANGES{{{200.0, 2000.0}, {0.0, 180.0}, {0.0, 360.0}}};
+
+    /**
+     * Default bins: 20 km shells, 5 deg inclination classes and no RAAN resolution
+     */
+    static constexpr std::array<size_t, 3> DEFAULT_BINS{90, 36, 1};
+
+    /**
+     * Creates a new DensityGridWriter.
+     * @param filename - the target file, ending with .csv or .npy
+     * @param ranges - the ranges [min, max[ of altitude [km], inclination [deg] and RAAN [deg]
+     * @param bins - the number of bins along altitude, inclination and RAAN
+     */
+    explicit DensityGridWriter(std::string filename,
+                               const std::array<std::array<double, 2>, 3> &ranges = DEFAULT_RANGES,
+                               const std::array<size_t, 3> &bins = DEFAULT_BINS)
+            : _filename{std::move(filename)},
+              _prototype{ranges, bins} {}
+
+    using OutputWriter::printResult;
+
+    void printResult(const std::vector<Satellite> &satelliteCollection) const override;
+
+    /**
+     * Calculates the density of the Satellites SoA with the Orbital Elements cached in the SoA.
+     * @param satellites
+     */
+    void printResult(const Satellites &satellites) const override;
+
+    /**
+     * Calculates the density grid without writing the result.
+     * @param satelliteCollection - vector of Satellites
+     * @return the filled Grid3D in [1/km^3]
+     */
+    [[nodiscard]] util::Grid3D createGrid(const std::vector<Satellite> &satelliteCollection) const;
+
+    /**
+     * Calculates the density grid without writing the result.
+     * @param satellites - Satellites SoA
+     * @return the filled Grid3D in [1/km^3]
+     */
+    [[nodiscard]] util::Grid3D createGrid(const Satellites &satellites) const;
+
+private:
+
+    /**
+     * Calculates the density grid from the Orbital Elements.
+     * @param keplerColumns - the Orbital Elements of the fragments
+     * @return the filled Grid3D in [1/km^3]
+     */
+    [[nodiscard]] util::Grid3D createGrid(const KeplerColumns &keplerColumns) const;
+
+    /**
+     * Writes the grid to the file.
+     * @param grid - Grid3D
+     * @throws std::runtime_error if the file ending is unknown or the file cannot be opened
+     */
+    void write(const util::Grid3D &grid) const;
+
+};
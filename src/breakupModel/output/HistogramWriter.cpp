@@ -0,0 +1,85 @@
+#include "HistogramWriter.h"
+
+void HistogramWriter::printResult(const std::vector<Satellite> &satelliteCollection) const {
+    this->write(this->createHistogram(satelliteCollection));
+}
+
+void HistogramWriter::printResult(const Satellites &satellites) const {
+    this->write(this->createHistogram(satellites));
+}
+
+util::Histogram2D HistogramWriter::createHistogram(const std::vector<Satellite> &satelliteCollection) const {
+    if (_histogramType == HistogramType::GABBARD) {
+        return this->createGabbard(KeplerColumns::fromCartesian(satelliteCollection));
+    }
+    return util::Histogram2D::build(_prototype, satelliteCollection.size(), [&](size_t i, util::Histogram2D &local) {
+        const auto &sat = satelliteCollection[i];
+        local.add(std::log10(sat.getCharacteristicLength()), std::log10(sat.getAreaToMassRatio()));
+    });
+}
+
+util::Histogram2D HistogramWriter::createHistogram(const Satellites &satellites) const {
+    if (_histogramType == HistogramType::GABBARD) {
+        return this->createGabbard(*satellites.getKeplerColumns());
+    }
+    return util::Histogram2D::build(_prototype, satellites.size(), [&](size_t i, util::Histogram2D &local) {
+        local.add(std::log10(satellites.characteristicLength[i]), std::log10(satellites.areaToMassRatio[i]));
+    });
+}
+
+std::array<std::array<double, 2>, 2> HistogramWriter::defaultRanges(HistogramType histogramType) {
+    switch (histogramType) {
+        case HistogramType::GABBARD:
+            //Period [min], altitude [km]
+            return {{{80.0, 200.0}, {0.0, 5000.0}}};
+        case HistogramType::AM_LC:
+        default:
+            //log10(L_c [m]), log10(A/M [m^2/kg])
+            return {{{-3.0, 1.0}, {-3.0, 2.0}}};
+    }
+}
+
+util::Histogram2D HistogramWriter::createGabbard(const KeplerColumns &keplerColumns) const {
+    const auto &elements = keplerColumns.orbitalElements;
+    return util::Histogram2D::build(_prototype, keplerColumns.size(), [&](size_t i, util::Histogram2D &local) {
+        const double a = elements.semiMajorAxis[i];
+        const double e = elements.eccentricity[i];
+        //Hyperbolic fragments have no period, they are counted as out of range
+        const double period = e < 1.0 ? util::PI2 / util::meanMotion(a) / 60.0 : std::nan("");
+        local.add(period, (a * (1.0 + e) - util::EARTH_RADIUS) / 1000.0);
+        local.add(period, (a * (1.0 - e) - util::EARTH_RADIUS) / 1000.0);
+    });
+}
+
+void HistogramWriter::write(const util::Histogram2D &histogram) const {
+    const std::string ending = _filename.substr(_filename.size() - std::min(_filename.size(), size_t{3}));
+    if (ending != "csv" && ending != "npy") {
+        throw std::runtime_error{"The histogram " + _filename + " can only be written as csv or npy!"};
+    }
+    std::ofstream file{_filename, ending == "npy" ? std::ios::out | std::ios::binary : std::ios::out};
+    if (!file) {
+        throw std::runtime_error{"The histogram file " + _filename + " could not be opened!"};
+    }
+
+    if (ending == "npy") {
+        util::writeNpy(file, histogram.getCounts().data(), {histogram.getXBins(), histogram.getYBins()});
+    } else {
+        file.precision(17);
+        file << "X lower,X upper,Y lower,Y upper,Count\n";
+        for (size_t x = 0; x < histogram.getXBins(); ++x) {
+            for (size_t y = 0; y < histogram.getYBins(); ++y) {
+                const auto count = histogram.getCount(x, y);
+                if (count == 0) {
+                    continue;
+                }
+                const double xLower = histogram.getXRange()[0] + static_cast<double>(x) * histogram.getXBinWidth();
+                const double yLower = histogram.getYRange()[0] + static_cast<double>(y) * histogram.getYBinWidth();
+                file << xLower << ',' << xLower + histogram.getXBinWidth() << ','
+                     << yLower << ',' << yLower + histogram.getYBinWidth() << ',' << count << '\n';
+            }
+        }
+    }
+    const auto &counts = histogram.getCounts();
+    spdlog::info("The histogram {} contains {} values, {} were out of range", _filename,
+                 std::accumulate(counts.begin(), counts.end(), std::uint64_t{0}), histogram.getOutOfRange());
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "OutputWriter.h"
+
+#include <array>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <numeric>
+#include <cmath>
+#include <stdexcept>
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityHistogram.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityNpy.h"
+#include "spdlog/spdlog.h"
+
+/**
+ * The kind of diagram which is binned by the HistogramWriter.
+ */
+enum class HistogramType {
+    /**
+     * Gabbard diagram: orbital period [min] (x) vs. apogee and perigee altitude [km] (y), each fragment adds two values
+     */
+    GABBARD,
+    /**
+     * log10 of the characteristic length [m] (x) vs. log10 of the area-to-mass ratio [m^2/kg] (y)
+     */
+    AM_LC
+};
+
+/**
+ * Analysis sink which bins the fragment cloud into a 2D histogram instead of printing every fragment.
+ * The binning runs in parallel (see util::Histogram2D::build), the result is written either as sparse CSV
+ * (only bins with a count > 0, with the bin edges) or as dense NPY array of counts with the shape (xBins, yBins).
+ * The format is chosen by the file ending (.csv or .npy).
+ */
+class HistogramWriter : public OutputWriter {
+
+    /**
+     * The target file
+     */
+    std::string _filename;
+
+    /**
+     * The kind of diagram
+     */
+    HistogramType _histogramType;
+
+    /**
+     * Defines the bins of the diagram
+     */
+    util::Histogram2D _prototype;
+
+public:
+
+    /**
+     * Creates a new HistogramWriter with the default ranges of the diagram type (fitting for a breakup in LEO).
+     * @param filename - the target file, ending with .csv or .npy
+     * @param histogramType - the kind of diagram
+     * @param bins - the number of bins along x and y (default: 200x200)
+     */
+    HistogramWriter(const std::string &filename, HistogramType histogramType,
+                    const std::array<size_t, 2> &bins = {200, 200})
+            : HistogramWriter(filename, histogramType, bins, defaultRanges(histogramType)) {}
+
+    /**
+     * Creates a new HistogramWriter.
+     * @param filename - the target file, ending with .csv or .npy
+     * @param histogramType - the kind of diagram
+     * @param bins - the number of bins along x and y
+     * @param ranges - the ranges [min, max[ of x and y (in the units of the diagram type)
+     */
+    HistogramWriter(std::string filename, HistogramType histogramType, const std::array<size_t, 2> &bins,
+                    const std::array<std::array<double, 2>, 2> &ranges)
+            : _filename{std::move(filename)},
+              _histogramType{histogramType},
+              _prototype{ranges[0], ranges[1], bins[0], bins[1]} {}
+
+    using OutputWriter::printResult;
+
+    void printResult(const std::vector<Satellite> &satelliteCollection) const override;
+
+    /**
+     * Bins the Satellites SoA, the Gabbard diagram uses the Orbital Elements cached in the SoA.
+     * @param satellites
+     */
+    void printResult(const Satellites &satellites) const override;
+
+    /**
+     * Bins the satellites without writing the result.
+     * @param satelliteCollection - vector of Satellites
+     * @return the filled Histogram2D
+     */
+    [[nodiscard]] util::Histogram2D createHistogram(const std::vector<Satellite> &satelliteCollection) const;
+
+    /**
+     * Bins the satellites without writing the result.
+     * @param satellites - Satellites SoA
+     * @return the filled Histogram2D
+     */
+    [[nodiscard]] util::Histogram2D createHistogram(const Satellites &satellites) const;
+
+    /**
+     * Returns the default ranges of a diagram type.
+     * @param histogramType - the kind of diagram
+     * @return array<x-range, y-range>
+     */
+    static std::array<std::array<double, 2>, 2> defaultRanges(HistogramType histogramType);
+
+private:
+
+    /**
+     * Bins the Gabbard diagram.
+     * @param keplerColumns - the Orbital Elements of the fragments
+     * @return the filled Histogram2D
+     */
+    [[nodiscard]] util::Histogram2D createGabbard(const KeplerColumns &keplerColumns) const;
+
+    /**
+     * Writes the histogram to the file.
+     * @param histogram - Histogram2D
+     * @throws std::runtime_error if the file ending is unknown or the file cannot be opened
+     */
+    void write(const util::Histogram2D &histogram) const;
+
+};
@@ -3,6 +3,7 @@
 #include <vector>
 #include <string>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
 #include "breakupModel/simulation/Breakup.h"
 
 /**
@@ -22,13 +23,23 @@ public:
      */
     virtual void printResult(const std::vector<Satellite> &satelliteCollection) const = 0;
 
+    /**
+     * Prints the Satellites SoA to an output source.
+     * Default implemented by converting the SoA into a vector of Satellite. Writers which profit from the columns
+     * (e.g. from the cached Orbital Elements) override this.
+     * @param satellites
+     */
+    virtual void printResult(const Satellites &satellites) const {
+        this->printResult(satellites.getAoS());
+    }
+
     /**
      * Prints the result Satellites to an output source.
      * Default implemented.
      * @param breakup
      */
     virtual void printResult(const Breakup &breakup) const {
-        this->printResult(breakup.getResult());
+        this->printResult(breakup.getResultSoA());
     }
 
 };
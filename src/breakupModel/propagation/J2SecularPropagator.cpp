@@ -0,0 +1,38 @@
+#include "J2SecularPropagator.h"
+
+OrbitalElementsColumns J2SecularPropagator::propagate(const OrbitalElementsColumns &orbitalElements,
+                                                      double timeStep) const {
+    using util::PI2;
+    using util::detail::normAngle;
+    OrbitalElementsColumns result{orbitalElements};
+    util::forEachIndex(result.size(), [&](size_t i) {
+        const double a = orbitalElements.semiMajorAxis[i];
+        const double e = orbitalElements.eccentricity[i];
+        const double EA = orbitalElements.eccentricAnomaly[i];
+        if (e < 1.0) {
+            const auto [raanRate, argOfPerRate, meanAnomalyRate] = secularRates(a, e, orbitalElements.inclination[i]);
+            const double MA = util::eccentricAnomalyToMeanAnomaly(EA, e) + meanAnomalyRate * timeStep;
+            result.longitudeOfTheAscendingNode[i] =
+                    normAngle(std::fmod(orbitalElements.longitudeOfTheAscendingNode[i] + raanRate * timeStep, PI2));
+            result.argumentOfPeriapsis[i] =
+                    normAngle(std::fmod(orbitalElements.argumentOfPeriapsis[i] + argOfPerRate * timeStep, PI2));
+            result.eccentricAnomaly[i] = util::meanAnomalyToEccentricAnomaly(MA, e);
+        } else {
+            result.eccentricAnomaly[i] = util::propagateAnomaly(EA, a, e, timeStep);
+        }
+    });
+    return result;
+}
+
+std::array<double, 3> J2SecularPropagator::secularRates(double a, double e, double i) {
+    using namespace util;
+    const double n = meanMotion(a);
+    const double p = a * (1.0 - e * e);
+    const double factor = 0.75 * n * J2_EARTH * (EARTH_RADIUS / p) * (EARTH_RADIUS / p);
+    const double cosI = std::cos(i);
+    const double cosI2 = cosI * cosI;
+
+    return {-2.0 * factor * cosI,
+            factor * (5.0 * cosI2 - 1.0),
+            n + factor * std::sqrt(1.0 - e * e) * (3.0 * cosI2 - 1.0)};
+}
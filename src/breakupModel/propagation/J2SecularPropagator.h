@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cmath>
+#include "Propagator.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * Propagates objects with the secular perturbations caused by the earth's oblateness (J2).
+ * The semi-major-axis, eccentricity and inclination stay constant, while the longitude of the ascending node, the
+ * argument of periapsis and the mean anomaly drift linearly with time. This nodal and apsidal drift is what spreads
+ * a fragment cloud into a shell over weeks.
+ * @note Hyperbolic objects are not bound to the earth, they are propagated on their two-body trajectory
+ * @related D. A. Vallado, "Fundamentals of Astrodynamics and Applications", 4th edition, Section 9.6
+ */
+class J2SecularPropagator : public Propagator {
+
+public:
+
+    J2SecularPropagator() = default;
+
+    ~J2SecularPropagator() override = default;
+
+    using Propagator::propagate;
+
+    [[nodiscard]] OrbitalElementsColumns propagate(const OrbitalElementsColumns &orbitalElements,
+                                                   double timeStep) const override;
+
+    /**
+     * Calculates the secular rates of an elliptic orbit caused by J2.
+     * @param a - semi-major-axis [m]
+     * @param e - eccentricity
+     * @param i - inclination [rad]
+     * @return array<rate of RAAN, rate of argument of periapsis, rate of mean anomaly (including mean motion)> in
+     * [rad/s]
+     */
+    static std::array<double, 3> secularRates(double a, double e, double i);
+
+};
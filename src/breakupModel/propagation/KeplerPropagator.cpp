@@ -0,0 +1,12 @@
+#include "KeplerPropagator.h"
+
+OrbitalElementsColumns KeplerPropagator::propagate(const OrbitalElementsColumns &orbitalElements,
+                                                   double timeStep) const {
+    OrbitalElementsColumns result{orbitalElements};
+    util::forEachIndex(result.size(), [&](size_t i) {
+        result.eccentricAnomaly[i] = util::propagateAnomaly(orbitalElements.eccentricAnomaly[i],
+                                                            orbitalElements.semiMajorAxis[i],
+                                                            orbitalElements.eccentricity[i], timeStep);
+    });
+    return result;
+}
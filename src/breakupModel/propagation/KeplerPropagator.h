@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Propagator.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * Propagates objects on the unperturbed two-body trajectory around the earth.
+ * Only the anomaly changes, elliptic (eccentric anomaly) and hyperbolic (Gudermannian) orbits are both supported.
+ * This fits for snapshots of a fragment cloud shortly after the breakup (hours to a few days).
+ */
+class KeplerPropagator : public Propagator {
+
+public:
+
+    KeplerPropagator() = default;
+
+    ~KeplerPropagator() override = default;
+
+    using Propagator::propagate;
+
+    [[nodiscard]] OrbitalElementsColumns propagate(const OrbitalElementsColumns &orbitalElements,
+                                                   double timeStep) const override;
+
+};
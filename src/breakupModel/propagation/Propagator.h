@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityMemory.h"
+
+/**
+ * The cartesian state of a whole fragment cloud at one point in time.
+ */
+struct CloudSnapshot {
+
+    /**
+     * The time since the reference epoch of the propagation (e.g. the breakup event) in [s]
+     */
+    double time{0.0};
+
+    /**
+     * The cartesian position of each object in [m]
+     */
+    util::ColumnVector<std::array<double, 3>> position{};
+
+    /**
+     * The cartesian velocity of each object in [m/s]
+     */
+    util::ColumnVector<std::array<double, 3>> velocity{};
+
+};
+
+/**
+ * Interface for the propagation of many objects at once (Pure virtual).
+ * The propagation is done on the Orbital Elements, each implementation advances them over a time step in parallel.
+ */
+class Propagator {
+
+public:
+
+    Propagator() = default;
+
+    virtual ~Propagator() = default;
+
+    /**
+     * Advances the Orbital Elements of all objects over a time step.
+     * @param orbitalElements - the Orbital Elements at the reference epoch
+     * @param timeStep - the time since the reference epoch in [s] (may be negative)
+     * @return the Orbital Elements at the reference epoch plus the time step
+     */
+    [[nodiscard]] virtual OrbitalElementsColumns propagate(const OrbitalElementsColumns &orbitalElements,
+                                                           double timeStep) const = 0;
+
+    /**
+     * Propagates a fragment cloud (e.g. the result of a Breakup) to several points in time.
+     * The Orbital Elements are calculated once and each snapshot is derived from them, so the times do not need to be
+     * sorted.
+     * Default implemented.
+     * @param satellites - the Satellites SoA at the reference epoch
+     * @param times - the times since the reference epoch in [s]
+     * @return one CloudSnapshot per time in the same order
+     */
+    [[nodiscard]] virtual std::vector<CloudSnapshot> propagate(const Satellites &satellites,
+                                                               const std::vector<double> &times) const {
+        const auto orbitalElements = OrbitalElementsColumns::fromCartesian(satellites);
+        std::vector<CloudSnapshot> snapshots{};
+        snapshots.reserve(times.size());
+        for (double time : times) {
+            auto [position, velocity] = this->propagate(orbitalElements, time).toCartesian();
+            snapshots.push_back(CloudSnapshot{time, std::move(position), std::move(velocity)});
+        }
+        return snapshots;
+    }
+
+    /**
+     * Propagates a fragment cloud in-place over a time step.
+     * Afterwards each satellite has its own position, so the fragmentPosition column of the Satellites is active.
+     * Default implemented.
+     * @param satellites - the Satellites SoA, will contain the state after the time step
+     * @param timeStep - the time step in [s]
+     */
+    virtual void advance(Satellites &satellites, double timeStep) const {
+        const auto orbitalElements = OrbitalElementsColumns::fromCartesian(satellites);
+        auto [position, velocity] = this->propagate(orbitalElements, timeStep).toCartesian();
+        satellites.fragmentPosition = std::move(position);
+        satellites.velocity = std::move(velocity);
+        satellites.invalidateKeplerColumns();
+    }
+
+};
@@ -0,0 +1,272 @@
+#include "SGP4Propagator.h"
+
+namespace {
+
+    /*
+     * WGS-72 constants as used by the TLEs
+     */
+    constexpr double RADIUS_EARTH_KM = 6378.135;
+    constexpr double MU_KM = 398600.8;
+    constexpr double J2 = 0.001082616;
+    constexpr double J3 = -0.00000253881;
+    constexpr double J4 = -0.00000165597;
+    constexpr double J3_OVER_J2 = J3 / J2;
+    constexpr double TWO_THIRD = 2.0 / 3.0;
+
+    /**
+     * Period in [min] from which on the deep space extension would be required
+     */
+    constexpr double DEEP_SPACE_PERIOD = 225.0;
+
+    /**
+     * sqrt(mu) in [earth radii^1.5 / min]
+     */
+    const double XKE = 60.0 / std::sqrt(RADIUS_EARTH_KM * RADIUS_EARTH_KM * RADIUS_EARTH_KM / MU_KM);
+
+    /**
+     * Returns the state used to mark an object which could not be propagated (e.g. decayed).
+     */
+    std::pair<std::array<double, 3>, std::array<double, 3>> invalidState() {
+        constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+        return {{nan, nan, nan}, {nan, nan, nan}};
+    }
+
+    /**
+     * Fallback for deep space objects: Secular J2 propagation of the mean elements.
+     */
+    std::pair<std::array<double, 3>, std::array<double, 3>>
+    propagateDeepSpace(const std::array<double, 6> &meanElements, double timeStep) {
+        OrbitalElementsColumns columns{1};
+        columns.setElement(0, meanElements);
+        const auto propagated = J2SecularPropagator{}.propagate(columns, timeStep);
+        return util::keplerianToCartesian(propagated.getElement(0).getAsArray());
+    }
+
+}
+
+std::pair<util::ColumnVector<std::array<double, 3>>, util::ColumnVector<std::array<double, 3>>>
+SGP4Propagator::propagate(const OrbitalElementsColumns &meanElements, const std::vector<double> &bstar,
+                          const std::vector<double> &timeSteps) const {
+    util::ColumnVector<std::array<double, 3>> position(meanElements.size());
+    util::ColumnVector<std::array<double, 3>> velocity(meanElements.size());
+    util::forEachIndex(meanElements.size(), [&](size_t i) {
+        auto [r, v] = propagate(meanElements.getElement(i).getAsArray(), bstar[i], timeSteps[i]);
+        position[i] = r;
+        velocity[i] = v;
+    });
+    return std::make_pair(std::move(position), std::move(velocity));
+}
+
+std::pair<std::array<double, 3>, std::array<double, 3>>
+SGP4Propagator::propagate(const std::array<double, 6> &meanElements, double bstar, double timeStep) {
+    using util::PI2;
+    const double ecco = meanElements[1];
+    const double inclo = meanElements[2];
+    const double nodeo = meanElements[3];
+    const double argpo = meanElements[4];
+    if (ecco >= 1.0) {
+        return invalidState();
+    }
+    const double mo = util::eccentricAnomalyToMeanAnomaly(meanElements[5], ecco);
+    //Kozai mean motion in [rad/min]
+    const double noKozai = util::meanMotion(meanElements[0]) * 60.0;
+    const double t = timeStep / 60.0;
+
+    // 1 - Initialization (recover the original mean motion and semi-major-axis)
+    const double eccsq = ecco * ecco;
+    const double omeosq = 1.0 - eccsq;
+    const double rteosq = std::sqrt(omeosq);
+    const double cosio = std::cos(inclo);
+    const double cosio2 = cosio * cosio;
+    const double sinio = std::sin(inclo);
+
+    const double ak = std::pow(XKE / noKozai, TWO_THIRD);
+    const double d1 = 0.75 * J2 * (3.0 * cosio2 - 1.0) / (rteosq * omeosq);
+    double del = d1 / (ak * ak);
+    const double adel = ak * (1.0 - del * del - del * (1.0 / 3.0 + 134.0 * del * del / 81.0));
+    del = d1 / (adel * adel);
+    const double no = noKozai / (1.0 + del);
+
+    if (PI2 / no >= DEEP_SPACE_PERIOD) {
+        return propagateDeepSpace(meanElements, timeStep);
+    }
+
+    const double ao = std::pow(XKE / no, TWO_THIRD);
+    const double po = ao * omeosq;
+    const double con42 = 1.0 - 5.0 * cosio2;
+    const double con41 = -con42 - cosio2 - cosio2;
+    const double posq = po * po;
+    const double rp = ao * (1.0 - ecco);
+
+    // 2 - Initialization of the drag and the secular coefficients
+    const bool isimp = rp < (220.0 / RADIUS_EARTH_KM + 1.0);
+    double sfour = 78.0 / RADIUS_EARTH_KM + 1.0;
+    double qzms24 = std::pow((120.0 - 78.0) / RADIUS_EARTH_KM, 4);
+    const double perige = (rp - 1.0) * RADIUS_EARTH_KM;
+    if (perige < 156.0) {
+        sfour = perige < 98.0 ? 20.0 : perige - 78.0;
+        qzms24 = std::pow((120.0 - sfour) / RADIUS_EARTH_KM, 4);
+        sfour = sfour / RADIUS_EARTH_KM + 1.0;
+    }
+    const double pinvsq = 1.0 / posq;
+    const double tsi = 1.0 / (ao - sfour);
+    const double eta = ao * ecco * tsi;
+    const double etasq = eta * eta;
+    const double eeta = ecco * eta;
+    const double psisq = std::abs(1.0 - etasq);
+    const double coef = qzms24 * std::pow(tsi, 4);
+    const double coef1 = coef / std::pow(psisq, 3.5);
+    const double cc2 = coef1 * no * (ao * (1.0 + 1.5 * etasq + eeta * (4.0 + etasq))
+                                     + 0.375 * J2 * tsi / psisq * con41 * (8.0 + 3.0 * etasq * (8.0 + etasq)));
+    const double cc1 = bstar * cc2;
+    const double cc3 = ecco > 1.0e-4 ? -2.0 * coef * tsi * J3_OVER_J2 * no * sinio / ecco : 0.0;
+    const double x1mth2 = 1.0 - cosio2;
+    const double cc4 = 2.0 * no * coef1 * ao * omeosq *
+                       (eta * (2.0 + 0.5 * etasq) + ecco * (0.5 + 2.0 * etasq) - J2 * tsi / (ao * psisq) *
+                        (-3.0 * con41 * (1.0 - 2.0 * eeta + etasq * (1.5 - 0.5 * eeta)) +
+                         0.75 * x1mth2 * (2.0 * etasq - eeta * (1.0 + etasq)) * std::cos(2.0 * argpo)));
+    const double cc5 = 2.0 * coef1 * ao * omeosq * (1.0 + 2.75 * (etasq + eeta) + eeta * etasq);
+    const double cosio4 = cosio2 * cosio2;
+    const double temp1 = 1.5 * J2 * pinvsq * no;
+    const double temp2 = 0.5 * temp1 * J2 * pinvsq;
+    const double temp3 = -0.46875 * J4 * pinvsq * pinvsq * no;
+    const double mdot = no + 0.5 * temp1 * rteosq * con41
+                        + 0.0625 * temp2 * rteosq * (13.0 - 78.0 * cosio2 + 137.0 * cosio4);
+    const double argpdot = -0.5 * temp1 * con42 + 0.0625 * temp2 * (7.0 - 114.0 * cosio2 + 395.0 * cosio4)
+                           + temp3 * (3.0 - 36.0 * cosio2 + 49.0 * cosio4);
+    const double xhdot1 = -temp1 * cosio;
+    const double nodedot = xhdot1
+                           + (0.5 * temp2 * (4.0 - 19.0 * cosio2) + 2.0 * temp3 * (3.0 - 7.0 * cosio2)) * cosio;
+    const double omgcof = bstar * cc3 * std::cos(argpo);
+    const double xmcof = ecco > 1.0e-4 ? -TWO_THIRD * coef * bstar / eeta : 0.0;
+    const double nodecf = 3.5 * omeosq * xhdot1 * cc1;
+    const double t2cof = 1.5 * cc1;
+    const double xlcof = -0.25 * J3_OVER_J2 * sinio * (3.0 + 5.0 * cosio) /
+                         (std::abs(cosio + 1.0) > 1.5e-12 ? 1.0 + cosio : 1.5e-12);
+    const double aycof = -0.5 * J3_OVER_J2 * sinio;
+    const double delmo = std::pow(1.0 + eta * std::cos(mo), 3);
+    const double sinmao = std::sin(mo);
+    const double x7thm1 = 7.0 * cosio2 - 1.0;
+
+    // 3 - Secular gravity and atmospheric drag
+    const double xmdf = mo + mdot * t;
+    const double argpdf = argpo + argpdot * t;
+    const double nodedf = nodeo + nodedot * t;
+    double argpm = argpdf;
+    double mm = xmdf;
+    const double t2 = t * t;
+    double nodem = nodedf + nodecf * t2;
+    double tempa = 1.0 - cc1 * t;
+    double tempe = bstar * cc4 * t;
+    double templ = t2cof * t2;
+
+    if (!isimp) {
+        const double cc1sq = cc1 * cc1;
+        const double d2 = 4.0 * ao * tsi * cc1sq;
+        const double temp = d2 * tsi * cc1 / 3.0;
+        const double d3 = (17.0 * ao + sfour) * temp;
+        const double d4 = 0.5 * temp * ao * tsi * (221.0 * ao + 31.0 * sfour) * cc1;
+        const double t3cof = d2 + 2.0 * cc1sq;
+        const double t4cof = 0.25 * (3.0 * d3 + cc1 * (12.0 * d2 + 10.0 * cc1sq));
+        const double t5cof = 0.2 * (3.0 * d4 + 12.0 * cc1 * d3 + 6.0 * d2 * d2 + 15.0 * cc1sq * (2.0 * d2 + cc1sq));
+
+        const double delomg = omgcof * t;
+        const double delm = xmcof * (std::pow(1.0 + eta * std::cos(xmdf), 3) - delmo);
+        mm = xmdf + delomg + delm;
+        argpm = argpdf - delomg - delm;
+        const double t3 = t2 * t;
+        const double t4 = t3 * t;
+        tempa = tempa - d2 * t2 - d3 * t3 - d4 * t4;
+        tempe = tempe + bstar * cc5 * (std::sin(mm) - sinmao);
+        templ = templ + t3cof * t3 + t4 * (t4cof + t * t5cof);
+    }
+
+    const double am = std::pow(XKE / no, TWO_THIRD) * tempa * tempa;
+    const double nm = XKE / std::pow(am, 1.5);
+    double em = ecco - tempe;
+    if (em >= 1.0 || em < -0.001) {
+        return invalidState();
+    }
+    em = std::max(em, 1.0e-6);
+    mm = mm + no * templ;
+    const double xlm = std::fmod(mm + argpm + nodem, PI2);
+    nodem = std::fmod(nodem, PI2);
+    argpm = std::fmod(argpm, PI2);
+    mm = std::fmod(xlm - argpm - nodem, PI2);
+
+    // 4 - Long period periodics
+    const double axnl = em * std::cos(argpm);
+    double temp = 1.0 / (am * (1.0 - em * em));
+    const double aynl = em * std::sin(argpm) + temp * aycof;
+    const double xl = mm + argpm + nodem + temp * xlcof * axnl;
+
+    // 5 - Solve Kepler's equation
+    const double u = std::fmod(xl - nodem, PI2);
+    double eo1 = u;
+    double tem5 = 9999.9;
+    double sineo1 = 0.0;
+    double coseo1 = 0.0;
+    for (int ktr = 1; std::abs(tem5) >= 1.0e-12 && ktr <= 10; ++ktr) {
+        sineo1 = std::sin(eo1);
+        coseo1 = std::cos(eo1);
+        tem5 = (u - aynl * coseo1 + axnl * sineo1 - eo1) / (1.0 - coseo1 * axnl - sineo1 * aynl);
+        tem5 = std::clamp(tem5, -0.95, 0.95);
+        eo1 += tem5;
+    }
+
+    // 6 - Short period preliminary quantities
+    const double ecose = axnl * coseo1 + aynl * sineo1;
+    const double esine = axnl * sineo1 - aynl * coseo1;
+    const double el2 = axnl * axnl + aynl * aynl;
+    const double pl = am * (1.0 - el2);
+    if (pl < 0.0) {
+        return invalidState();
+    }
+    const double rl = am * (1.0 - ecose);
+    const double rdotl = std::sqrt(am) * esine / rl;
+    const double rvdotl = std::sqrt(pl) / rl;
+    const double betal = std::sqrt(1.0 - el2);
+    temp = esine / (1.0 + betal);
+    const double sinu = am / rl * (sineo1 - aynl - axnl * temp);
+    const double cosu = am / rl * (coseo1 - axnl + aynl * temp);
+    double su = std::atan2(sinu, cosu);
+    const double sin2u = (cosu + cosu) * sinu;
+    const double cos2u = 1.0 - 2.0 * sinu * sinu;
+    temp = 1.0 / pl;
+    const double temp1p = 0.5 * J2 * temp;
+    const double temp2p = temp1p * temp;
+
+    // 7 - Update for short period periodics
+    const double mrt = rl * (1.0 - 1.5 * temp2p * betal * con41) + 0.5 * temp1p * x1mth2 * cos2u;
+    su = su - 0.25 * temp2p * x7thm1 * sin2u;
+    const double xnode = nodem + 1.5 * temp2p * cosio * sin2u;
+    const double xinc = inclo + 1.5 * temp2p * cosio * sinio * cos2u;
+    const double mvt = rdotl - nm * temp1p * x1mth2 * sin2u / XKE;
+    const double rvdot = rvdotl + nm * temp1p * (x1mth2 * cos2u + 1.5 * con41) / XKE;
+    if (mrt < 1.0) {
+        return invalidState();
+    }
+
+    // 8 - Orientation vectors
+    const double sinsu = std::sin(su);
+    const double cossu = std::cos(su);
+    const double snod = std::sin(xnode);
+    const double cnod = std::cos(xnode);
+    const double sini = std::sin(xinc);
+    const double cosi = std::cos(xinc);
+    const double xmx = -snod * cosi;
+    const double xmy = cnod * cosi;
+    const std::array<double, 3> uVector{xmx * sinsu + cnod * cossu, xmy * sinsu + snod * cossu, sini * sinsu};
+    const std::array<double, 3> vVector{xmx * cossu - cnod * sinsu, xmy * cossu - snod * sinsu, sini * cossu};
+
+    // 9 - Position and velocity in [m] and [m/s]
+    static constexpr double kmToM = 1000.0;
+    const double positionFactor = mrt * RADIUS_EARTH_KM * kmToM;
+    const double velocityFactor = RADIUS_EARTH_KM * XKE / 60.0 * kmToM;
+    std::pair<std::array<double, 3>, std::array<double, 3>> state{};
+    for (size_t j = 0; j < 3; ++j) {
+        state.first[j] = positionFactor * uVector[j];
+        state.second[j] = (mvt * uVector[j] + rvdot * vVector[j]) * velocityFactor;
+    }
+    return state;
+}
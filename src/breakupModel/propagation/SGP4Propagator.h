@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "J2SecularPropagator.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityMemory.h"
+#include "breakupModel/util/UtilityParallel.h"
+
+/**
+ * Propagates TLE mean elements with the SGP4 model (near earth part) to cartesian states in the TEME frame.
+ * In contrast to the other Propagators the time step may differ for each object, so that a whole catalog with
+ * individual TLE epochs can be brought to one common epoch in one parallel call.
+ * @note Objects with a period of 225 minutes or more would require the deep space extension (SDP4). These objects are
+ * propagated with the secular J2 rates instead (see J2SecularPropagator), which neglects the luni-solar perturbations
+ * and the drag.
+ * @note Objects which decay during the propagation get NaN as position and velocity
+ * @related D. A. Vallado, P. Crawford, R. Hujsak, T.S. Kelso, "Revisiting Spacetrack Report #3", AIAA 2006-6753,
+ * (WGS-72 constants, "improved" operation mode)
+ */
+class SGP4Propagator {
+
+public:
+
+    SGP4Propagator() = default;
+
+    /**
+     * Propagates many objects in parallel.
+     * @param meanElements - the TLE mean elements (e.g. as read by the TLEReader)
+     * @param bstar - the drag term B* of each object in [1/earth radii]
+     * @param timeSteps - the time since the TLE epoch of each object in [s]
+     * @return pair<positions [m], velocities [m/s]> in the TEME frame and in the order of the elements
+     */
+    [[nodiscard]] std::pair<util::ColumnVector<std::array<double, 3>>, util::ColumnVector<std::array<double, 3>>>
+    propagate(const OrbitalElementsColumns &meanElements, const std::vector<double> &bstar,
+              const std::vector<double> &timeSteps) const;
+
+    /**
+     * Propagates one object. This is the kernel of the batch propagation.
+     * @param meanElements - array<a, e, i, W, w, eccentric-anomaly> of the TLE mean elements
+     * @param bstar - the drag term B* in [1/earth radii]
+     * @param timeStep - the time since the TLE epoch in [s]
+     * @return pair<position [m], velocity [m/s]> in the TEME frame
+     */
+    static std::pair<std::array<double, 3>, std::array<double, 3>>
+    propagate(const std::array<double, 6> &meanElements, double bstar, double timeStep);
+
+};
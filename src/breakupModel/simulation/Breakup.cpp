@@ -22,7 +22,10 @@ void Breakup::run() {
     //6. Step: Calculate the Ejection velocity for every Satellite
     this->deltaVelocityDistribution();
 
-    //7. Step: As a last step set the _currentMaxGivenID to the new valid value
+    //7. Step: Remove the fragments which reenter or escape (optional)
+    this->cullFragments();
+
+    //8. Step: As a last step set the _currentMaxGivenID to the new valid value
     _currentMaxGivenID += _output.size();
 }
 
@@ -35,9 +38,15 @@ Breakup &Breakup::setSeed(std::optional<unsigned long> seed) {
     return *this;
 }
 
+Breakup &Breakup::setCullingAltitude(std::optional<double> cullingAltitude) {
+    _cullingAltitude = cullingAltitude;
+    return *this;
+}
+
 void Breakup::init() {
     _inputMass = 0;
     _outputMass = 0;
+    _cullingStatistics = CullingStatistics{};
 }
 
 void Breakup::generateFragments(size_t fragmentCount, const std::array<double, 3> &position) {
@@ -133,6 +142,50 @@ void Breakup::deltaVelocityDistribution() {
     });
 }
 
+void Breakup::cullFragments() {
+    if (!_cullingAltitude.has_value()) {
+        return;
+    }
+    enum Fate : char {KEEP, REENTRY, ESCAPE};
+    constexpr double mu = util::GRAVITATIONAL_PARAMETER_EARTH;
+    const double minimalPerigee = util::EARTH_RADIUS + _cullingAltitude.value();
+    std::vector<char> fate(_output.size(), KEEP);
+    util::forEachIndex(_output.size(), [&](size_t i) {
+        const auto &r = _output.getPosition(i);
+        const auto &v = _output.velocity[i];
+        const double rNorm = std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+        const double energy = 0.5 * (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) - mu / rNorm;
+        if (energy >= 0.0) {
+            fate[i] = ESCAPE;
+            return;
+        }
+        //Perigee radius r_p = p / (1 + e) with the semi-latus rectum p = h^2 / mu
+        const std::array<double, 3> h{r[1] * v[2] - r[2] * v[1], r[2] * v[0] - r[0] * v[2],
+                                      r[0] * v[1] - r[1] * v[0]};
+        const double hSquared = h[0] * h[0] + h[1] * h[1] + h[2] * h[2];
+        const double e = std::sqrt(std::max(0.0, 1.0 + 2.0 * energy * hSquared / (mu * mu)));
+        if (hSquared / mu / (1.0 + e) < minimalPerigee) {
+            fate[i] = REENTRY;
+        }
+    });
+
+    for (size_t i = 0; i < fate.size(); ++i) {
+        if (fate[i] == REENTRY) {
+            ++_cullingStatistics.reentryCount;
+            _cullingStatistics.reentryMass += _output.mass[i];
+        } else if (fate[i] == ESCAPE) {
+            ++_cullingStatistics.escapeCount;
+            _cullingStatistics.escapeMass += _output.mass[i];
+        }
+    }
+    _output.removeIf([&](size_t i) { return fate[i] != KEEP; });
+    _outputMass -= _cullingStatistics.reentryMass + _cullingStatistics.escapeMass;
+
+    spdlog::info("Culled {} reentering fragments ({} kg) and {} escaping fragments ({} kg)",
+                 _cullingStatistics.reentryCount, _cullingStatistics.reentryMass,
+                 _cullingStatistics.escapeCount, _cullingStatistics.escapeMass);
+}
+
 double Breakup::calculateCharacteristicLength() {
     using util::transformUniformToPowerLaw;
     static std::uniform_real_distribution<> uniformRealDistribution{0.0, 1.0};
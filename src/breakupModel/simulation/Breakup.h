@@ -16,9 +16,38 @@
 #include "breakupModel/util/UtilityContainer.h"
 #include "breakupModel/util/UtilityFunctions.h"
 #include "breakupModel/util/UtilityAreaMassRatio.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityParallel.h"
 #include "spdlog/spdlog.h"
 #include "spdlog/fmt/ostr.h"
 
+/**
+ * Number and mass of the fragments which were removed by the culling stage of a Breakup.
+ */
+struct CullingStatistics {
+
+    /**
+     * Number of fragments with a perigee below the culling altitude
+     */
+    size_t reentryCount{0};
+
+    /**
+     * Mass of the fragments with a perigee below the culling altitude in [kg]
+     */
+    double reentryMass{0.0};
+
+    /**
+     * Number of fragments on hyperbolic trajectories
+     */
+    size_t escapeCount{0};
+
+    /**
+     * Mass of the fragments on hyperbolic trajectories in [kg]
+     */
+    double escapeMass{0.0};
+
+};
+
 /**
  * Pure virtual class which needs a Collection of Satellites as input and output and simulates a breakup
  * which is either a collision or an explosion.
@@ -76,6 +105,18 @@ protected:
      */
     bool _enforceMassConservation{false};
 
+    /**
+     * The minimal perigee altitude of the fragments in [m].
+     * If this is set, the method cullFragments() removes the fragments which reenter or escape after the delta
+     * velocity was applied. Per default no fragments are culled.
+     */
+    std::optional<double> _cullingAltitude{std::nullopt};
+
+    /**
+     * Contains the number and mass of the fragments removed by cullFragments() in the last run
+     */
+    CullingStatistics _cullingStatistics{};
+
     /**
      * Contains the Power Law Exponent for the L_c distribution.
      * This constant is correctly set-up in the subclasses by an init method.
@@ -161,7 +202,7 @@ public:
      * Return the result of the breakup event.
      * @return vector of satellites containing the generated fragments in an SoA
      */
-    [[nodiscard]] Satellites getResultSoA() const {
+    [[nodiscard]] const Satellites &getResultSoA() const {
         return _output;
     }
 
@@ -175,6 +216,22 @@ public:
      */
     Breakup &setSeed(std::optional<unsigned long> seed = std::nullopt);
 
+    /**
+     * Sets the minimal perigee altitude of the fragments. Fragments which reenter (perigee below this altitude) or
+     * escape (hyperbolic trajectory) are then removed from the result at the end of run().
+     * @param cullingAltitude - the altitude in [m] or the nullopt to keep all fragments (default)
+     * @return this
+     */
+    Breakup &setCullingAltitude(std::optional<double> cullingAltitude = std::nullopt);
+
+    /**
+     * Returns the number and mass of the fragments removed by the culling stage during the last run.
+     * @return CullingStatistics (all zero if no culling altitude is set)
+     */
+    [[nodiscard]] const CullingStatistics &getCullingStatistics() const {
+        return _cullingStatistics;
+    }
+
 protected:
 
     /**
@@ -242,6 +299,14 @@ protected:
      */
     void deltaVelocityDistribution();
 
+    /**
+     * Removes the fragments which reenter (perigee altitude below _cullingAltitude) or escape (non-negative orbital
+     * energy) and records their number and mass in _cullingStatistics. The perigee is calculated in one parallel
+     * pass directly from the cartesian state, afterwards the SoA is compacted.
+     * Does nothing if no _cullingAltitude is set.
+     */
+    void cullFragments();
+
     /**
      * This Method calculates one characteristic Length for one Debris Particle.
      * This method uses equation (2) and (4) from the the NASA Breakup Model Paper.
@@ -2,11 +2,15 @@
 
 BreakupBuilder &BreakupBuilder::reconfigure(const std::shared_ptr<InputConfigurationSource> &configurationSource) {
     _configurationSource = configurationSource;
+    //The new DataSource is read at the end, the old one must not be read again when the filter changes
+    _dataSource = nullptr;
+    _pushedFilter = std::nullopt;
     this->setMinimalCharacteristicLength(configurationSource->getMinimalCharacteristicLength());
     this->setSimulationType(configurationSource->getTypeOfSimulation());
     this->setCurrentMaximalGivenID(configurationSource->getCurrentMaximalGivenID()),
     this->setIDFilter(configurationSource->getIDFilter());
     this->setEnforceMassConservation(configurationSource->getEnforceMassConservation());
+    this->setCullingAltitude(configurationSource->getCullingAltitude());
     this->setDataSource(configurationSource->getDataReader());
     return *this;
 }
@@ -28,11 +32,21 @@ BreakupBuilder &BreakupBuilder::setSimulationType(SimulationType simulationType)
 
 BreakupBuilder &BreakupBuilder::setCurrentMaximalGivenID(const std::optional<size_t> &currentMaximalGivenID) {
     _currentMaximalGivenID = currentMaximalGivenID;
+    if (_dataSource != nullptr && _pushedFilter.has_value() && !_currentMaximalGivenID.has_value() &&
+        !_sourceMaximalID.has_value()) {
+        _sourceMaximalID = _dataSource->getMaximalID();
+    }
     return *this;
 }
 
 BreakupBuilder &BreakupBuilder::setIDFilter(const std::optional<std::set<size_t>> &idFilter) {
     _idFilter = idFilter;
+    //The already read satellites only suffice if the new filter selects a subset of the pushed down one
+    if (_dataSource != nullptr && _pushedFilter.has_value() &&
+        (!_idFilter.has_value() || !std::includes(_pushedFilter->cbegin(), _pushedFilter->cend(),
+                                                  _idFilter->cbegin(), _idFilter->cend()))) {
+        this->setDataSource(_dataSource);
+    }
     return *this;
 }
 
@@ -41,16 +55,50 @@ BreakupBuilder &BreakupBuilder::setEnforceMassConservation(bool enforceMassConse
     return *this;
 }
 
+BreakupBuilder &BreakupBuilder::setCullingAltitude(const std::optional<double> &cullingAltitude) {
+    _cullingAltitude = cullingAltitude;
+    return *this;
+}
+
 BreakupBuilder &BreakupBuilder::setDataSource(const std::vector<Satellite> &satellites) {
     _satellites = satellites;
+    _dataSource = nullptr;
+    _pushedFilter = std::nullopt;
+    _sourceMaximalID = std::nullopt;
+    this->indexSatellites();
     return *this;
 }
 
 BreakupBuilder &BreakupBuilder::setDataSource(const std::shared_ptr<const DataSource> &dataSource) {
-    _satellites = dataSource->getSatelliteCollection();
+    _dataSource = dataSource;
+    _pushedFilter = _idFilter;
+    if (_idFilter.has_value()) {
+        //Only the filtered satellites are read, the maximal ID still refers to the whole source
+        if (_currentMaximalGivenID.has_value()) {
+            _satellites = dataSource->getFilteredSatelliteCollection(_idFilter.value());
+            _sourceMaximalID = std::nullopt;
+        } else {
+            auto [satellites, maximalID] = dataSource->getFilteredSatelliteCollectionWithMaximalID(_idFilter.value());
+            _satellites = std::move(satellites);
+            _sourceMaximalID = maximalID;
+        }
+    } else {
+        _satellites = dataSource->getSatelliteCollection();
+        _sourceMaximalID = std::nullopt;
+    }
+    this->indexSatellites();
     return *this;
 }
 
+std::set<size_t> BreakupBuilder::findIDsInRegime(const OrbitalRegimeQuery &query) {
+    if (!_regimeIndex.has_value()) {
+        //With a pushed down filter _satellites only contains the filtered ones, the query refers to the whole source
+        _regimeIndex = _dataSource != nullptr && _pushedFilter.has_value() ? _dataSource->getOrbitalRegimeIndex()
+                                                                           : OrbitalRegimeIndex{_satellites};
+    }
+    return _regimeIndex->findIDs(query);
+}
+
 std::unique_ptr<Breakup> BreakupBuilder::getBreakup() const {
     //1. Step: Max ID is derived from all available Satellites, not from only those contained in the filter
     size_t maxID = this->deriveMaximalID();
@@ -101,21 +149,40 @@ std::unique_ptr<Breakup> BreakupBuilder::getBreakup() const {
 }
 
 std::unique_ptr<Breakup> BreakupBuilder::createExplosion(std::vector<Satellite> &satelliteVector, size_t maxID) const {
-    return std::make_unique<Explosion>(satelliteVector, _minimalCharacteristicLength, maxID, _enforceMassConservation);
+    auto explosion = std::make_unique<Explosion>(satelliteVector, _minimalCharacteristicLength, maxID,
+                                                 _enforceMassConservation);
+    explosion->setCullingAltitude(_cullingAltitude);
+    return explosion;
 }
 
 std::unique_ptr<Breakup> BreakupBuilder::createCollision(std::vector<Satellite> &satelliteVector, size_t maxID) const {
-    return std::make_unique<Collision>(satelliteVector, _minimalCharacteristicLength, maxID, _enforceMassConservation);
+    auto collision = std::make_unique<Collision>(satelliteVector, _minimalCharacteristicLength, maxID,
+                                                 _enforceMassConservation);
+    collision->setCullingAltitude(_cullingAltitude);
+    return collision;
 }
 
 std::vector<Satellite> BreakupBuilder::applyFilter() const {
-    if (_idFilter.has_value()) {
-        std::vector<Satellite> satellitesFiltered{_satellites};
-        satellitesFiltered.erase(std::remove_if(satellitesFiltered.begin(), satellitesFiltered.end(),
-                                                [&](Satellite &sat) {
-                                                    return _idFilter->count(sat.getId()) == 0;
-                                                }),
-                                 satellitesFiltered.end());
+    if (_idFilter.has_value() && _satelliteIndex.size() != _satellites.size()) {
+        //An ID appears several times, but the index only knows its first position --> scan to keep every match
+        std::vector<Satellite> satellitesFiltered{};
+        std::copy_if(_satellites.cbegin(), _satellites.cend(), std::back_inserter(satellitesFiltered),
+                     [this](const Satellite &satellite) { return _idFilter->count(satellite.getId()) != 0; });
+        return satellitesFiltered;
+    } else if (_idFilter.has_value()) {
+        std::vector<size_t> positions{};
+        for (const size_t id : _idFilter.value()) {
+            const size_t position = _satelliteIndex.find(id);
+            if (position != util::IdIndex::NOT_FOUND) {
+                positions.push_back(position);
+            }
+        }
+        //Keep the order of the input
+        std::sort(positions.begin(), positions.end());
+        std::vector<Satellite> satellitesFiltered{};
+        satellitesFiltered.reserve(positions.size());
+        std::transform(positions.cbegin(), positions.cend(), std::back_inserter(satellitesFiltered),
+                       [this](size_t position) { return _satellites[position]; });
         return satellitesFiltered;
     } else {
         return _satellites;
@@ -123,8 +190,17 @@ std::vector<Satellite> BreakupBuilder::applyFilter() const {
 }
 
 size_t BreakupBuilder::deriveMaximalID() const {
-    return _currentMaximalGivenID.value_or(_satellites.empty() ? 0 :
-                                           std::max_element(_satellites.begin(), _satellites.end(),
-                                                            [](const Satellite &sat1, const Satellite &sat2) {
-                                                                return sat1.getId() < sat2.getId();})->getId());
+    if (_currentMaximalGivenID.has_value()) {
+        return _currentMaximalGivenID.value();
+    }
+    return _sourceMaximalID.value_or(_maximalID);
+}
+
+void BreakupBuilder::indexSatellites() {
+    _regimeIndex = std::nullopt;
+    _satelliteIndex = util::IdIndex::build(_satellites.size(), [this](size_t i) { return _satellites[i].getId(); });
+    _maximalID = _satellites.empty() ? 0 :
+                 std::max_element(_satellites.cbegin(), _satellites.cend(),
+                                  [](const Satellite &sat1, const Satellite &sat2) {
+                                      return sat1.getId() < sat2.getId();})->getId();
 }
@@ -5,8 +5,13 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <iterator>
+#include <optional>
+#include <set>
 #include "breakupModel/input/InputConfigurationSource.h"
 #include "breakupModel/input/DataSource.h"
+#include "breakupModel/model/OrbitalRegimeIndex.h"
+#include "breakupModel/util/UtilityHashIndex.h"
 #include "Breakup.h"
 #include "Explosion.h"
 #include "Collision.h"
@@ -29,8 +34,42 @@ class BreakupBuilder {
 
     std::vector<Satellite> _satellites;
 
+    /**
+     * Maps the ID of a satellite to its position in _satellites (the first one if an ID appears twice), rebuilt
+     * whenever the satellites are replaced
+     */
+    util::IdIndex _satelliteIndex{};
+
+    /**
+     * The maximal ID of _satellites (zero if there are none)
+     */
+    size_t _maximalID{0};
+
+    /**
+     * The range index over the orbital regime of _satellites (or of the whole _dataSource if a filter was pushed
+     * down), built on the first query after the satellites were replaced
+     */
+    std::optional<OrbitalRegimeIndex> _regimeIndex{std::nullopt};
+
+    /**
+     * The DataSource _satellites were read from (nullptr if they were given directly as vector)
+     */
+    std::shared_ptr<const DataSource> _dataSource{nullptr};
+
+    /**
+     * The ID filter which was pushed down into _dataSource (then _satellites only contains the filtered satellites)
+     */
+    std::optional<std::set<size_t>> _pushedFilter{std::nullopt};
+
+    /**
+     * The maximal ID of the whole DataSource if the ID filter was pushed down into it
+     */
+    std::optional<size_t> _sourceMaximalID{std::nullopt};
+
     bool _enforceMassConservation;
 
+    std::optional<double> _cullingAltitude;
+
 public:
 
     explicit BreakupBuilder(const std::shared_ptr<InputConfigurationSource> &configurationSource)
@@ -40,7 +79,9 @@ public:
               _currentMaximalGivenID{configurationSource->getCurrentMaximalGivenID()},
               _idFilter{configurationSource->getIDFilter()},
               _enforceMassConservation{configurationSource->getEnforceMassConservation()},
-              _satellites{configurationSource->getDataReader()->getSatelliteCollection()} {}
+              _cullingAltitude{configurationSource->getCullingAltitude()} {
+        this->setDataSource(configurationSource->getDataReader());
+    }
 
     /**
      * Adds an input source for the satellites.
@@ -72,7 +113,8 @@ public:
 
     /**
      * Overrides/ Re-Sets the currentMaximalGivenID (e.g. maximal given NORAD Catalog ID) to a specific value.
-     * If the nullopt is chosen, the maximal ID is derived from the input satellites.
+     * If the nullopt is chosen, the maximal ID is derived from the input satellites (or the whole DataSource if the
+     * ID filter was pushed down into it).
      * @param currentMaximalGivenID - std::optional<size_t>
      * @return this
      */
@@ -81,6 +123,8 @@ public:
     /**
      * Overrides/ Re-Sets the ID Filter and sets it to a new set.
      * @param idFilter - contains the IDs of satellites which should be used, the rest is discarded
+     * If the satellites were read from a DataSource with another filter pushed down and the new filter is not a
+     * subset of it, the DataSource is read again.
      * @return this
      */
     BreakupBuilder &setIDFilter(const std::optional<std::set<size_t>> &idFilter);
@@ -92,6 +136,13 @@ public:
      */
     BreakupBuilder &setEnforceMassConservation(bool enforceMassConservation);
 
+    /**
+     * Overrides/ Re-Sets the culling altitude in [m]. If the nullopt is chosen, no fragments are culled.
+     * @param cullingAltitude - minimal perigee altitude of the fragments in [m]
+     * @return this
+     */
+    BreakupBuilder &setCullingAltitude(const std::optional<double> &cullingAltitude);
+
     /**
      * Overrides/ Re-Sets the Data Source to a specific Satellite vector
      * @param satellites - vector of satellites
@@ -101,12 +152,24 @@ public:
 
     /**
      * Overrides/ Re-Sets the Data Source and calls the method getSatelliteCollection on it to set the internal
-     * satellites member.
+     * satellites member. If an ID filter is set, it is pushed down into the DataSource
+     * and the maximal ID of the whole DataSource is determined in the same pass
+     * (getFilteredSatelliteCollectionWithMaximalID).
      * @param dataSource - a pointer to an DataSource
      * @return this
      */
     BreakupBuilder &setDataSource(const std::shared_ptr<const DataSource> &dataSource);
 
+    /**
+     * Returns the IDs of the satellites (of the current Data Source) inside an orbital regime, e.g. to select the
+     * participants of a breakup with setIDFilter(). The query is not restricted by the ID filter, if the filter was
+     * pushed down into the Data Source the index is built from the whole Data Source. The range index is built once
+     * per Data Source and reused by the following queries.
+     * @param query - the bounds of the regime
+     * @return the IDs
+     */
+    std::set<size_t> findIDsInRegime(const OrbitalRegimeQuery &query);
+
     /**
      * Creates a new Breakup Simulation with the given input.
      * Can either be a Collision or an Explosion depending on the satellite number in the SatelliteCollection.
@@ -138,7 +201,9 @@ private:
 
     /**
      * Returns an vector containing only the satellites given in the filterSet.
-     * @return a modified satellite vector
+     * Every filtered ID is looked up in the _satelliteIndex, so the cost depends on the size of the filter and not on
+     * the number of satellites. If an ID appears several times, all satellites are scanned to keep every match.
+     * @return a modified satellite vector (in the order of the satellites)
      */
     [[nodiscard]] std::vector<Satellite> applyFilter() const;
 
@@ -148,4 +213,9 @@ private:
      * @return size_t - maxID
      */
     [[nodiscard]] size_t deriveMaximalID() const;
+
+    /**
+     * Rebuilds the _satelliteIndex and the _maximalID after the satellites were replaced.
+     */
+    void indexSatellites();
 };
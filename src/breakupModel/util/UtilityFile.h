@@ -0,0 +1,531 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
+#include <optional>
+#include <limits>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <filesystem>
+#include <random>
+#include <system_error>
+#include "UtilityParallel.h"
+
+#ifdef BREAKUP_MODEL_ZLIB
+
+#include <zlib.h>
+
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BREAKUP_MODEL_MMAP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+namespace util {
+
+    /**
+     * Read-only view of a whole file.
+     * On POSIX systems the file is memory-mapped (no copy, the pages are loaded on demand by the OS), on other
+     * systems the file is read into a buffer once.
+     * @note The view is only valid as long as the MappedFile exists
+     */
+    class MappedFile {
+
+        const char *_data{nullptr};
+
+        size_t _size{0};
+
+#ifndef BREAKUP_MODEL_MMAP
+        std::vector<char> _buffer{};
+#endif
+
+    public:
+
+        /**
+         * Maps the file.
+         * @param filepath - the path of the file
+         * @throws std::runtime_error if the file cannot be opened or mapped
+         */
+        explicit MappedFile(const std::string &filepath) {
+#ifdef BREAKUP_MODEL_MMAP
+            const int fileDescriptor = ::open(filepath.c_str(), O_RDONLY);
+            if (fileDescriptor < 0) {
+                throw std::runtime_error{"The file " + filepath + " could not be opened!"};
+            }
+            struct stat fileStatus{};
+            if (::fstat(fileDescriptor, &fileStatus) != 0) {
+                ::close(fileDescriptor);
+                throw std::runtime_error{"The size of the file " + filepath + " could not be determined!"};
+            }
+            _size = static_cast<size_t>(fileStatus.st_size);
+            //An empty file cannot be mapped, the view is empty then
+            if (_size > 0) {
+                void *mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                if (mapping == MAP_FAILED) {
+                    ::close(fileDescriptor);
+                    throw std::runtime_error{"The file " + filepath + " could not be memory-mapped!"};
+                }
+                ::madvise(mapping, _size, MADV_SEQUENTIAL);
+                _data = static_cast<const char *>(mapping);
+            }
+            //The mapping stays valid after closing the descriptor
+            ::close(fileDescriptor);
+#else
+            std::ifstream fileStream{filepath, std::ios::binary};
+            if (!fileStream) {
+                throw std::runtime_error{"The file " + filepath + " could not be opened!"};
+            }
+            _buffer.assign(std::istreambuf_iterator<char>{fileStream}, std::istreambuf_iterator<char>{});
+            _data = _buffer.data();
+            _size = _buffer.size();
+#endif
+        }
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        ~MappedFile() {
+#ifdef BREAKUP_MODEL_MMAP
+            if (_data != nullptr) {
+                ::munmap(const_cast<char *>(_data), _size);
+            }
+#endif
+        }
+
+        /**
+         * Returns the content of the file.
+         * @return string_view of the whole file
+         */
+        [[nodiscard]] std::string_view view() const {
+            return std::string_view{_data, _size};
+        }
+
+    };
+
+    /**
+     * Calls the function for every line of the text (without the line break).
+     * @tparam Function - callable (std::string_view line)
+     * @param text - the text
+     * @param function - the function called for every line
+     */
+    template<typename Function>
+    void forEachLine(std::string_view text, Function function) {
+        while (!text.empty()) {
+            const size_t end = text.find('\n');
+            function(text.substr(0, end));
+            if (end == std::string_view::npos) {
+                break;
+            }
+            text.remove_prefix(end + 1);
+        }
+    }
+
+    /**
+     * Splits a text into (at most) chunkCount contiguous chunks of about the same size which can be processed in
+     * parallel. Each chunk starts at the beginning of a line for which isRecordStart returns true (or at the beginning
+     * of the text), so that a record consisting of several lines is never split.
+     * @tparam Predicate - callable (std::string_view line) -> bool
+     * @param text - the text
+     * @param chunkCount - the wished number of chunks
+     * @param isRecordStart - returns true if a line is the first line of a record
+     * @return vector of chunks, their concatenation is the text
+     */
+    template<typename Predicate>
+    std::vector<std::string_view> splitIntoChunks(std::string_view text, size_t chunkCount, Predicate isRecordStart) {
+        std::vector<std::string_view> chunks{};
+        size_t begin = 0;
+        for (size_t chunk = 1; chunk < chunkCount && begin < text.size(); ++chunk) {
+            //Start at the nominal position and search the next line which starts a record
+            size_t cut = std::max(begin, text.size() * chunk / chunkCount);
+            if (cut > 0 && text[cut - 1] != '\n') {
+                cut = text.find('\n', cut);
+                cut = cut == std::string_view::npos ? text.size() : cut + 1;
+            }
+            while (cut < text.size() && !isRecordStart(text.substr(cut, text.find('\n', cut) - cut))) {
+                cut = text.find('\n', cut);
+                cut = cut == std::string_view::npos ? text.size() : cut + 1;
+            }
+            if (cut > begin) {
+                chunks.push_back(text.substr(begin, cut - begin));
+                begin = cut;
+            }
+        }
+        if (begin < text.size()) {
+            chunks.push_back(text.substr(begin));
+        }
+        return chunks;
+    }
+
+    /**
+     * Parses a number from a fixed-width text field without allocations (std::from_chars).
+     * Leading spaces and a leading plus sign are skipped, parsing stops at the first character which does not belong
+     * to the number.
+     * @tparam T - an arithmetic type
+     * @param field - the text field
+     * @return the parsed number
+     * @throws std::runtime_error if the field does not start with a number
+     */
+    template<typename T>
+    T parseNumber(std::string_view field) {
+        static_assert(std::is_arithmetic_v<T>, "Only numbers can be parsed!");
+        const size_t first = field.find_first_not_of(' ');
+        if (first == std::string_view::npos) {
+            throw std::runtime_error{"An empty field cannot be parsed to a number!"};
+        }
+        field.remove_prefix(first);
+        if (field.front() == '+') {
+            field.remove_prefix(1);
+        }
+        T value{};
+        //std::next instead of pointer arithmetic, so that the generic container operators are not considered
+        const auto [ptr, errorCode] = std::from_chars(field.data(), std::next(field.data(), field.size()), value);
+        if (errorCode != std::errc{} || ptr == field.data()) {
+            throw std::runtime_error{"The field \"" + std::string{field} + "\" could not be parsed to a number!"};
+        }
+        return value;
+    }
+
+    /**
+     * Hashes bytes with the 64-bit FNV-1a hash.
+     * @param bytes - the data
+     * @param seed - the initial hash, allows to chain several calls (default: the FNV offset basis)
+     * @return hash
+     */
+    inline std::uint64_t fnv1a(std::string_view bytes, std::uint64_t seed = 0xCBF29CE484222325ULL) {
+        std::uint64_t hash = seed;
+        for (const char byte : bytes) {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * Hashes the content of a (large) file in parallel. The content is split into blocks of a fixed size, so the
+     * result does not depend on the number of threads. The block hashes are chained with fnv1a in their order.
+     * @param content - e.g. the view of a MappedFile
+     * @return hash
+     */
+    inline std::uint64_t hashContent(std::string_view content) {
+        constexpr size_t blockSize = size_t{1} << 20u;
+        const size_t blocks = (content.size() + blockSize - 1) / blockSize;
+        std::vector<std::uint64_t> blockHashes(blocks);
+        forEachIndex(blocks, [&](size_t block) {
+            blockHashes[block] = fnv1a(content.substr(block * blockSize, blockSize));
+        });
+        std::uint64_t hash = fnv1a(std::string_view{});
+        for (const std::uint64_t blockHash : blockHashes) {
+            hash = fnv1a(std::string_view{reinterpret_cast<const char *>(&blockHash), sizeof(blockHash)}, hash);
+        }
+        return hash;
+    }
+
+    /**
+     * Writes a file atomically: The writer fills a unique temporary file next to the target, which is then renamed, so
+     * that readers see either the old or the new file. The temporary file is removed if writing or renaming fails.
+     * @tparam Writer - callable std::ofstream & -> void
+     * @param filepath - the path of the file
+     * @param writer - writes the content into the stream
+     * @throws std::runtime_error if the file cannot be opened or written, errors of the writer and rename are rethrown
+     */
+    template<typename Writer>
+    void writeFileAtomically(const std::string &filepath, Writer writer) {
+        const std::string temporaryPath = filepath + ".tmp" + std::to_string(std::random_device{}());
+        try {
+            {
+                std::ofstream file{temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc};
+                if (!file) {
+                    throw std::runtime_error{"The file " + temporaryPath + " could not be opened!"};
+                }
+                writer(file);
+                if (!file) {
+                    throw std::runtime_error{"The file " + temporaryPath + " could not be written!"};
+                }
+            }
+            std::filesystem::rename(temporaryPath, filepath);
+        } catch (...) {
+            std::error_code errorCode{};
+            std::filesystem::remove(temporaryPath, errorCode);
+            throw;
+        }
+    }
+
+    /**
+     * The compression of an input file, detected by the magic bytes at its beginning.
+     */
+    enum class Compression {
+        NONE, GZIP, ZSTD
+    };
+
+    /**
+     * Detects the compression of a file by its magic bytes.
+     * @param content - the (raw) content of the file
+     * @return Compression
+     */
+    inline Compression detectCompression(std::string_view content) {
+        if (content.substr(0, 2) == std::string_view{"\x1F\x8B", 2}) {
+            return Compression::GZIP;
+        } else if (content.substr(0, 4) == std::string_view{"\x28\xB5\x2F\xFD", 4}) {
+            return Compression::ZSTD;
+        }
+        return Compression::NONE;
+    }
+
+    namespace detail {
+
+        /**
+         * Bounded queue of text blocks between one producer and one consumer thread.
+         */
+        class BlockQueue {
+
+            std::mutex _mutex{};
+
+            std::condition_variable _changed{};
+
+            std::deque<std::string> _blocks{};
+
+            const size_t _capacity;
+
+            bool _finished{false};
+
+            bool _cancelled{false};
+
+            std::optional<std::string> _error{};
+
+        public:
+
+            explicit BlockQueue(size_t capacity)
+                    : _capacity{capacity} {}
+
+            /**
+             * Adds a block, waits while the queue is full.
+             * @param block - the block
+             * @return false if the consumer cancelled, the producer should stop then
+             */
+            bool push(std::string block) {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _changed.wait(lock, [this] { return _blocks.size() < _capacity || _cancelled; });
+                if (_cancelled) {
+                    return false;
+                }
+                _blocks.push_back(std::move(block));
+                _changed.notify_all();
+                return true;
+            }
+
+            /**
+             * Takes the next block, waits until one is available.
+             * @return the block or nullopt if the producer finished and all blocks were taken
+             * @throws std::runtime_error if the producer failed
+             */
+            std::optional<std::string> pop() {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _changed.wait(lock, [this] { return !_blocks.empty() || _finished; });
+                if (!_blocks.empty()) {
+                    std::string block{std::move(_blocks.front())};
+                    _blocks.pop_front();
+                    _changed.notify_all();
+                    return block;
+                }
+                if (_error.has_value()) {
+                    throw std::runtime_error{_error.value()};
+                }
+                return std::nullopt;
+            }
+
+            /**
+             * Called by the producer after the last block or on an error.
+             * @param error - the error message if the producer failed
+             */
+            void finish(std::optional<std::string> error = std::nullopt) {
+                const std::lock_guard<std::mutex> lock{_mutex};
+                _finished = true;
+                _error = std::move(error);
+                _changed.notify_all();
+            }
+
+            /**
+             * Called by the consumer if it does not need further blocks.
+             */
+            void cancel() {
+                const std::lock_guard<std::mutex> lock{_mutex};
+                _cancelled = true;
+                _changed.notify_all();
+            }
+
+        };
+
+        /**
+         * Returns the position where a text can be cut without splitting a record: The beginning of the last complete
+         * line which starts a record.
+         * @tparam Predicate - callable (std::string_view line) -> bool
+         * @param text - the text
+         * @param isRecordStart - returns true if a line is the first line of a record
+         * @return the position or zero if the text contains no such line (besides the first one)
+         */
+        template<typename Predicate>
+        size_t findRecordCut(std::string_view text, Predicate isRecordStart) {
+            size_t lineEnd = text.rfind('\n');
+            while (lineEnd != std::string_view::npos && lineEnd > 0) {
+                const size_t previousEnd = text.rfind('\n', lineEnd - 1);
+                if (previousEnd == std::string_view::npos) {
+                    return 0;
+                }
+                const size_t lineStart = previousEnd + 1;
+                if (isRecordStart(text.substr(lineStart, lineEnd - lineStart))) {
+                    return lineStart;
+                }
+                lineEnd = previousEnd;
+            }
+            return 0;
+        }
+
+#ifdef BREAKUP_MODEL_ZLIB
+
+        /**
+         * Decompresses gzip data (several concatenated members are allowed) and pushes it as blocks which end in
+         * front of a record start.
+         * @tparam Predicate - callable (std::string_view line) -> bool
+         * @param compressed - the compressed content
+         * @param blockSize - the size from which on a block is cut
+         * @param isRecordStart - returns true if a line is the first line of a record
+         * @param queue - the queue which receives the blocks
+         * @throws std::runtime_error if the data is corrupt
+         */
+        template<typename Predicate>
+        void inflateGzip(std::string_view compressed, size_t blockSize, Predicate isRecordStart, BlockQueue &queue) {
+            z_stream stream{};
+            //15 window bits + 16 selects the gzip format
+            if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+                throw std::runtime_error{"The gzip decompression could not be initialized!"};
+            }
+            std::string block{};
+            const size_t step = std::min<size_t>(blockSize, size_t{1} << 20u);
+            size_t consumed = 0;
+            try {
+                while (true) {
+                    if (stream.avail_in == 0 && consumed < compressed.size()) {
+                        const std::string_view input = compressed.substr(consumed, std::numeric_limits<uInt>::max());
+                        stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input.data()));
+                        stream.avail_in = static_cast<uInt>(input.size());
+                        consumed += input.size();
+                    }
+                    const size_t oldSize = block.size();
+                    block.resize(oldSize + step);
+                    stream.next_out = reinterpret_cast<Bytef *>(&block[oldSize]);
+                    stream.avail_out = static_cast<uInt>(step);
+                    const int result = inflate(&stream, Z_NO_FLUSH);
+                    block.resize(oldSize + step - stream.avail_out);
+
+                    const bool inputLeft = stream.avail_in > 0 || consumed < compressed.size();
+                    if (result == Z_STREAM_END) {
+                        if (!inputLeft) {
+                            break;
+                        }
+                        //Another gzip member follows
+                        inflateReset(&stream);
+                    } else if (result == Z_BUF_ERROR && !inputLeft) {
+                        throw std::runtime_error{"The gzip data is truncated!"};
+                    } else if (result != Z_OK && result != Z_BUF_ERROR) {
+                        throw std::runtime_error{"The gzip data is corrupt!"};
+                    }
+
+                    if (block.size() >= blockSize) {
+                        const size_t cut = findRecordCut(block, isRecordStart);
+                        if (cut > 0) {
+                            std::string rest = block.substr(cut);
+                            block.resize(cut);
+                            if (!queue.push(std::move(block))) {
+                                inflateEnd(&stream);
+                                return;
+                            }
+                            block = std::move(rest);
+                        }
+                    }
+                }
+            } catch (...) {
+                inflateEnd(&stream);
+                throw;
+            }
+            inflateEnd(&stream);
+            if (!block.empty()) {
+                queue.push(std::move(block));
+            }
+        }
+
+#endif
+
+    }
+
+    /**
+     * Passes the text of a file in consecutive blocks to a consumer. Every block ends in front of a line for which
+     * isRecordStart returns true, so that no record is split between two blocks.
+     * An uncompressed file is memory-mapped and passed as one block. A gzip-compressed file (detected by its magic
+     * bytes, requires zlib, i.e. BREAKUP_MODEL_ZLIB) is decompressed on a background thread while the consumer
+     * processes the previous block, so the decompressed file is never written to disk and never resident at once.
+     * @tparam Predicate - callable (std::string_view line) -> bool, called on the background thread
+     * @tparam Consumer - callable (std::string_view block) -> bool, returns false if no further blocks are needed
+     * @param filepath - the path of the file
+     * @param isRecordStart - returns true if a line is the first line of a record
+     * @param consume - called with every block in the order of the file
+     * @param blockSize - the (approximate) size of the decompressed blocks in bytes (default 16 MiB)
+     * @throws std::runtime_error if the file cannot be read or is corrupt, exceptions of the consumer are propagated
+     */
+    template<typename Predicate, typename Consumer>
+    void forEachTextBlock(const std::string &filepath, Predicate isRecordStart, Consumer consume,
+                          size_t blockSize = size_t{16} << 20u) {
+        const MappedFile file{filepath};
+        const Compression compression = detectCompression(file.view());
+        if (compression == Compression::NONE) {
+            consume(file.view());
+            return;
+        } else if (compression == Compression::ZSTD) {
+            throw std::runtime_error{"The file " + filepath + " is zstd-compressed, only gzip is supported!"};
+        }
+#ifdef BREAKUP_MODEL_ZLIB
+        detail::BlockQueue queue{2};
+        std::thread producer{[&] {
+            try {
+                detail::inflateGzip(file.view(), blockSize, isRecordStart, queue);
+                queue.finish();
+            } catch (std::exception &e) {
+                queue.finish("The file " + filepath + " could not be decompressed: " + e.what());
+            }
+        }};
+        try {
+            while (auto block = queue.pop()) {
+                if (!consume(std::string_view{block.value()})) {
+                    break;
+                }
+            }
+        } catch (...) {
+            queue.cancel();
+            producer.join();
+            throw;
+        }
+        queue.cancel();
+        producer.join();
+#else
+        throw std::runtime_error{"The file " + filepath + " is gzip-compressed, but the program was built without "
+                                 "zlib!"};
+#endif
+    }
+
+}
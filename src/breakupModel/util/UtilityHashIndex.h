@@ -0,0 +1,166 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+
+namespace util {
+
+    /**
+     * Open-addressing hash table (linear probing) from a satellite ID to an index, e.g. the position of the satellite
+     * in a vector or column. Keys and values are stored in two flat arrays, so a lookup touches one or two cache lines
+     * instead of chasing the nodes of a std::map.
+     * The table only grows, entries cannot be removed. Lookups are const and can run concurrently.
+     * @note The key SIZE_MAX is reserved as empty marker
+     */
+    class IdIndex {
+
+        static constexpr size_t EMPTY = SIZE_MAX;
+
+        std::vector<size_t> _keys;
+
+        std::vector<size_t> _values;
+
+        size_t _size{0};
+
+    public:
+
+        /**
+         * Returned by find() if the key is not contained
+         */
+        static constexpr size_t NOT_FOUND = SIZE_MAX;
+
+        /**
+         * Creates an empty index.
+         * @param expectedSize - the number of keys which are expected, avoids rehashing (default: 0)
+         */
+        explicit IdIndex(size_t expectedSize = 0) {
+            size_t capacity = 16;
+            //The load factor is kept below 0.5 for short probe sequences
+            while (capacity < 2 * expectedSize) {
+                capacity *= 2;
+            }
+            _keys.assign(capacity, EMPTY);
+            _values.assign(capacity, 0);
+        }
+
+        /**
+         * Builds an index over the keys of a sequence. If a key appears multiple times, the first occurrence is kept.
+         * @tparam KeyOf - callable size_t -> size_t returning the key of the element at an index
+         * @param size - the number of elements
+         * @param keyOf - the accessor to the key of an element
+         * @return IdIndex mapping each key to the index of its first occurrence
+         */
+        template<typename KeyOf>
+        static IdIndex build(size_t size, KeyOf keyOf) {
+            IdIndex index{size};
+            for (size_t i = 0; i < size; ++i) {
+                index.insert(keyOf(i), i);
+            }
+            return index;
+        }
+
+        /**
+         * Inserts a key with its value if the key is not yet contained.
+         * @param key - the ID
+         * @param value - the index
+         * @return true if the key was inserted, false if it was already contained (the old value is kept)
+         * @throws std::runtime_error if the key is the reserved SIZE_MAX
+         */
+        bool insert(size_t key, size_t value) {
+            if (key == EMPTY) {
+                throw std::runtime_error{"The ID " + std::to_string(key) + " is reserved and cannot be indexed!"};
+            }
+            if (2 * (_size + 1) > _keys.size()) {
+                this->rehash(2 * _keys.size());
+            }
+            size_t slot = this->slotOf(key);
+            if (_keys[slot] == key) {
+                return false;
+            }
+            _keys[slot] = key;
+            _values[slot] = value;
+            ++_size;
+            return true;
+        }
+
+        /**
+         * Returns the value of a key.
+         * @param key - the ID
+         * @return the index or NOT_FOUND
+         */
+        [[nodiscard]] size_t find(size_t key) const {
+            if (key == EMPTY) {
+                return NOT_FOUND;
+            }
+            const size_t slot = this->slotOf(key);
+            return _keys[slot] == key ? _values[slot] : NOT_FOUND;
+        }
+
+        /**
+         * Returns true if the key is contained.
+         * @param key - the ID
+         * @return true if contained
+         */
+        [[nodiscard]] bool contains(size_t key) const {
+            return this->find(key) != NOT_FOUND;
+        }
+
+        /**
+         * Returns the number of keys.
+         * @return size
+         */
+        [[nodiscard]] size_t size() const {
+            return _size;
+        }
+
+    private:
+
+        /**
+         * Mixes the bits of the key (finalizer of splitmix64), since IDs are mostly consecutive numbers.
+         * @param key - the ID
+         * @return hash
+         */
+        static std::uint64_t hash(std::uint64_t key) {
+            key = (key ^ (key >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+            key = (key ^ (key >> 27u)) * 0x94D049BB133111EBULL;
+            return key ^ (key >> 31u);
+        }
+
+        /**
+         * Returns the slot which contains the key or the empty slot where it would be inserted.
+         * @param key - the ID
+         * @return slot index
+         */
+        [[nodiscard]] size_t slotOf(size_t key) const {
+            const size_t mask = _keys.size() - 1;
+            size_t slot = static_cast<size_t>(hash(key)) & mask;
+            while (_keys[slot] != key && _keys[slot] != EMPTY) {
+                slot = (slot + 1) & mask;
+            }
+            return slot;
+        }
+
+        /**
+         * Moves all entries into a table with a new capacity.
+         * @param capacity - the new capacity (a power of two)
+         */
+        void rehash(size_t capacity) {
+            std::vector<size_t> keys(capacity, EMPTY);
+            std::vector<size_t> values(capacity, 0);
+            std::swap(_keys, keys);
+            std::swap(_values, values);
+            for (size_t i = 0; i < keys.size(); ++i) {
+                if (keys[i] != EMPTY) {
+                    const size_t slot = this->slotOf(keys[i]);
+                    _keys[slot] = keys[i];
+                    _values[slot] = values[i];
+                }
+            }
+        }
+
+    };
+
+}
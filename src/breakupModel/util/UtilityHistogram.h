@@ -0,0 +1,286 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <thread>
+#include <stdexcept>
+#include "UtilityParallel.h"
+
+namespace util {
+
+    /**
+     * Fills a histogram/ grid in parallel. The elements are split into contiguous chunks, each chunk is binned into
+     * its own local copy of the prototype and the local copies are merged at the end, so no synchronization is needed.
+     * @tparam Grid - the histogram type, needs to be copyable and provide merge(const Grid &)
+     * @tparam Function - callable (size_t index, Grid &local) which adds the values of one element
+     * @param prototype - an empty histogram which defines the bins
+     * @param size - the number of elements
+     * @param addElement - the function which adds the values of the element with the index to a local histogram
+     * @return the filled histogram
+     */
+    template<typename Grid, typename Function>
+    Grid buildParallel(const Grid &prototype, size_t size, Function addElement) {
+        const size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const size_t chunks = std::clamp(size, size_t{1}, 4 * hardwareThreads);
+        std::vector<Grid> locals(chunks, prototype);
+        forEachIndex(chunks, [&](size_t chunk) {
+            const size_t end = size * (chunk + 1) / chunks;
+            for (size_t i = size * chunk / chunks; i < end; ++i) {
+                addElement(i, locals[chunk]);
+            }
+        });
+        Grid result{prototype};
+        for (const auto &local : locals) {
+            result.merge(local);
+        }
+        return result;
+    }
+
+    /**
+     * A two-dimensional histogram with equidistant bins on the intervals [min, max[ of both axes.
+     * The counts are saved in row-major order, i.e. the index of the bin (x, y) is x * yBins + y.
+     * Values outside the ranges (or NaN) are not binned, but counted separately.
+     */
+    class Histogram2D {
+
+        std::array<double, 2> _xRange;
+
+        std::array<double, 2> _yRange;
+
+        size_t _xBins;
+
+        size_t _yBins;
+
+        std::vector<std::uint64_t> _counts;
+
+        std::uint64_t _outOfRange{0};
+
+    public:
+
+        /**
+         * Creates an empty histogram.
+         * @param xRange - [min, max[ of the x-axis
+         * @param yRange - [min, max[ of the y-axis
+         * @param xBins - number of bins along the x-axis
+         * @param yBins - number of bins along the y-axis
+         * @throws std::runtime_error if a range is empty or a bin count is zero
+         */
+        Histogram2D(const std::array<double, 2> &xRange, const std::array<double, 2> &yRange,
+                    size_t xBins, size_t yBins)
+                : _xRange{xRange},
+                  _yRange{yRange},
+                  _xBins{xBins},
+                  _yBins{yBins},
+                  _counts(xBins * yBins, 0) {
+            if (xBins == 0 || yBins == 0 || !(xRange[0] < xRange[1]) || !(yRange[0] < yRange[1])) {
+                throw std::runtime_error{"A histogram needs at least one bin and non-empty ranges [min, max["};
+            }
+        }
+
+        /**
+         * Adds one value pair to the histogram.
+         * @param x - value on the x-axis
+         * @param y - value on the y-axis
+         */
+        void add(double x, double y) {
+            //Written as negation, so that NaN is out of range, too
+            if (!(x >= _xRange[0] && x < _xRange[1] && y >= _yRange[0] && y < _yRange[1])) {
+                ++_outOfRange;
+                return;
+            }
+            const auto xIndex = std::min(static_cast<size_t>((x - _xRange[0]) / getXBinWidth()), _xBins - 1);
+            const auto yIndex = std::min(static_cast<size_t>((y - _yRange[0]) / getYBinWidth()), _yBins - 1);
+            ++_counts[xIndex * _yBins + yIndex];
+        }
+
+        /**
+         * Adds the counts of another histogram with the same bins to this one.
+         * @param other - Histogram2D
+         * @throws std::runtime_error if the bins are different
+         */
+        void merge(const Histogram2D &other) {
+            if (_xRange != other._xRange || _yRange != other._yRange ||
+                _xBins != other._xBins || _yBins != other._yBins) {
+                throw std::runtime_error{"Only histograms with the same bins can be merged!"};
+            }
+            for (size_t i = 0; i < _counts.size(); ++i) {
+                _counts[i] += other._counts[i];
+            }
+            _outOfRange += other._outOfRange;
+        }
+
+        /**
+         * Fills a histogram in parallel, see util::buildParallel.
+         * @tparam Function - callable (size_t index, Histogram2D &local) which adds the values of one element
+         * @param prototype - an empty histogram which defines the bins
+         * @param size - the number of elements
+         * @param addElement - the function which adds the values of the element with the index to a local histogram
+         * @return the filled histogram
+         */
+        template<typename Function>
+        static Histogram2D build(const Histogram2D &prototype, size_t size, Function addElement) {
+            return buildParallel(prototype, size, addElement);
+        }
+
+        /**
+         * Returns the count of one bin.
+         * @param xIndex - index of the bin along the x-axis
+         * @param yIndex - index of the bin along the y-axis
+         * @return count
+         */
+        [[nodiscard]] std::uint64_t getCount(size_t xIndex, size_t yIndex) const {
+            return _counts[xIndex * _yBins + yIndex];
+        }
+
+        /**
+         * Returns all counts in row-major order (x * yBins + y).
+         * @return vector of counts
+         */
+        [[nodiscard]] const std::vector<std::uint64_t> &getCounts() const {
+            return _counts;
+        }
+
+        /**
+         * Returns the number of values which were outside of the ranges.
+         * @return count
+         */
+        [[nodiscard]] std::uint64_t getOutOfRange() const {
+            return _outOfRange;
+        }
+
+        [[nodiscard]] const std::array<double, 2> &getXRange() const {
+            return _xRange;
+        }
+
+        [[nodiscard]] const std::array<double, 2> &getYRange() const {
+            return _yRange;
+        }
+
+        [[nodiscard]] size_t getXBins() const {
+            return _xBins;
+        }
+
+        [[nodiscard]] size_t getYBins() const {
+            return _yBins;
+        }
+
+        [[nodiscard]] double getXBinWidth() const {
+            return (_xRange[1] - _xRange[0]) / static_cast<double>(_xBins);
+        }
+
+        [[nodiscard]] double getYBinWidth() const {
+            return (_yRange[1] - _yRange[0]) / static_cast<double>(_yBins);
+        }
+
+    };
+
+    /**
+     * A three-dimensional grid of weights (e.g. a density) with equidistant bins on the intervals [min, max[ of each
+     * axis. The values are saved in row-major order, i.e. the index of the bin (i, j, k) is
+     * (i * bins[1] + j) * bins[2] + k.
+     */
+    class Grid3D {
+
+        std::array<std::array<double, 2>, 3> _ranges;
+
+        std::array<size_t, 3> _bins;
+
+        std::vector<double> _values;
+
+    public:
+
+        /**
+         * Creates a grid with all values zero.
+         * @param ranges - [min, max[ of the three axes
+         * @param bins - number of bins along the three axes
+         * @throws std::runtime_error if a range is empty or a bin count is zero
+         */
+        Grid3D(const std::array<std::array<double, 2>, 3> &ranges, const std::array<size_t, 3> &bins)
+                : _ranges{ranges},
+                  _bins{bins},
+                  _values(bins[0] * bins[1] * bins[2], 0.0) {
+            for (size_t axis = 0; axis < 3; ++axis) {
+                if (bins[axis] == 0 || !(ranges[axis][0] < ranges[axis][1])) {
+                    throw std::runtime_error{"A grid needs at least one bin and non-empty ranges [min, max["};
+                }
+            }
+        }
+
+        /**
+         * Returns the index of the bin which contains the value.
+         * @param axis - 0, 1 or 2
+         * @param value - the value along the axis
+         * @return the index or getBins(axis) if the value is out of range (or NaN)
+         */
+        [[nodiscard]] size_t getBinIndex(size_t axis, double value) const {
+            if (!(value >= _ranges[axis][0] && value < _ranges[axis][1])) {
+                return _bins[axis];
+            }
+            return std::min(static_cast<size_t>((value - _ranges[axis][0]) / getBinWidth(axis)), _bins[axis] - 1);
+        }
+
+        /**
+         * Adds a weight to one bin.
+         * @param i - index along the first axis
+         * @param j - index along the second axis
+         * @param k - index along the third axis
+         * @param weight - the value to add
+         */
+        void add(size_t i, size_t j, size_t k, double weight) {
+            _values[(i * _bins[1] + j) * _bins[2] + k] += weight;
+        }
+
+        /**
+         * Adds the values of another grid with the same bins to this one.
+         * @param other - Grid3D
+         * @throws std::runtime_error if the bins are different
+         */
+        void merge(const Grid3D &other) {
+            if (_ranges != other._ranges || _bins != other._bins) {
+                throw std::runtime_error{"Only grids with the same bins can be merged!"};
+            }
+            for (size_t i = 0; i < _values.size(); ++i) {
+                _values[i] += other._values[i];
+            }
+        }
+
+        [[nodiscard]] double getValue(size_t i, size_t j, size_t k) const {
+            return _values[(i * _bins[1] + j) * _bins[2] + k];
+        }
+
+        /**
+         * Returns all values in row-major order.
+         * @return vector of values
+         */
+        [[nodiscard]] const std::vector<double> &getValues() const {
+            return _values;
+        }
+
+        [[nodiscard]] const std::array<double, 2> &getRange(size_t axis) const {
+            return _ranges[axis];
+        }
+
+        [[nodiscard]] size_t getBins(size_t axis) const {
+            return _bins[axis];
+        }
+
+        [[nodiscard]] double getBinWidth(size_t axis) const {
+            return (_ranges[axis][1] - _ranges[axis][0]) / static_cast<double>(_bins[axis]);
+        }
+
+        /**
+         * Returns the lower edge of a bin.
+         * @param axis - 0, 1 or 2
+         * @param index - index of the bin along the axis (getBins(axis) gives the upper edge of the last bin)
+         * @return lower edge
+         */
+        [[nodiscard]] double getLowerEdge(size_t axis, size_t index) const {
+            return _ranges[axis][0] + static_cast<double>(index) * getBinWidth(axis);
+        }
+
+    };
+
+}
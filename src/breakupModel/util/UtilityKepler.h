@@ -1,13 +1,18 @@
 #pragma once
 
 #include <cmath>
+#include <array>
+#include <algorithm>
+#include <utility>
 #include "UtilityFunctions.h"
+#include "UtilityParallel.h"
 
 /*
  * Functions adapted from pykep:
  * -https://github.com/esa/pykep/blob/master/include/keplerian_toolbox/core_functions/convert_anomalies.hpp
- * -https://github.com/esa/pykep/blob/master/include/keplerian_toolbox/numerics/newton_raphson.hpp
  * -https://github.com/esa/pykep/blob/master/include/keplerian_toolbox/core_functions/kepler_equations.hpp
+ * -https://github.com/esa/pykep/blob/master/include/keplerian_toolbox/core_functions/ic2par.hpp
+ * -https://github.com/esa/pykep/blob/master/include/keplerian_toolbox/core_functions/par2ic.hpp
  * [Links accessed 23.06.2021]
  */
 
@@ -18,32 +23,35 @@ namespace util {
     */
     constexpr double GRAVITATIONAL_PARAMETER_EARTH = 398600441880000.0;
 
-    namespace detail {
-
-        constexpr double accuracy = 1e-16;
-
+    /**
+    * Equatorial radius of the earth in [m] (WGS-84)
+    */
+    constexpr double EARTH_RADIUS = 6378137.0;
 
-        // With the eccentric anomaly (EA)
-        inline double kepE(double EA, double MA, double eccentricity) {
-            return (EA - eccentricity * std::sin(EA) - MA);
-        }
+    /**
+    * Second zonal harmonic coefficient of the earth's gravity field (unit-less, EGM-96)
+    */
+    constexpr double J2_EARTH = 1.08262668e-3;
 
-        inline double d_kepE(double EA, double eccentricity) {
-            return (1.0 - eccentricity * std::cos(EA));
-        }
+    namespace detail {
 
-        inline double newtonRaphson(double EA, double MA, double e) {
-            int max_loop = 100;
-            double term;
-            // double start = x; //DS: unused
-            // main iteration
-            do {
-                term = kepE(EA, MA, e) / d_kepE(EA, e);
-                EA = EA - term;
-            }
-                // check if term is within required accuracy or loop limit is exceeded
-            while ((std::fabs(term / std::max(std::fabs(EA), 1.)) > accuracy) && (--max_loop));
-            return EA;
+        /**
+         * Calculates the starting value for the Kepler equation after Markley. The approximation has a maximal
+         * error of about 1e-4 rad for all elliptic eccentricities.
+         * @param MA - Mean Anomaly [rad] in [0, pi]
+         * @param e - eccentricity in [0, 1[
+         * @return approximation of the Eccentric Anomaly [rad]
+         * @related F. L. Markley, "Kepler Equation Solver", Celestial Mechanics and Dynamical Astronomy 63 (1995)
+         */
+        inline double markleyStarter(double MA, double e) {
+            static constexpr double PI_SQUARED = PI * PI;
+            const double alpha = (3.0 * PI_SQUARED + 1.6 * PI * (PI - MA) / (1.0 + e)) / (PI_SQUARED - 6.0);
+            const double d = 3.0 * (1.0 - e) + alpha * e;
+            const double q = 2.0 * alpha * d * (1.0 - e) - MA * MA;
+            const double r = 3.0 * alpha * d * (d - 1.0 + e) * MA + MA * MA * MA;
+            static constexpr double twoThird = 2.0 / 3.0;
+            const double w = std::pow(std::abs(r) + std::sqrt(q * q * q + r * r), twoThird);
+            return (2.0 * r * w / (w * w + w * q + q * q) + MA) / d;
         }
 
         /**
@@ -58,15 +66,50 @@ namespace util {
     }
 
     /**
-     * Converts the Mean Anomaly to the Eccentric Anomaly.
+     * Converts the Mean Anomaly to the Eccentric Anomaly (elliptic orbits only).
+     * The Kepler equation is solved with a fixed number of operations: Markley's starting value followed by one
+     * fifth-order correction step and one final Newton step, which gives machine precision for all e in [0, 1[.
+     * Since there is no data-dependent iteration, the function is suitable for the batch conversion below.
      * @param MA - Mean Anomaly [rad]
      * @param e - eccentricity
-     * @return Eccentric Anomaly in [rad]
+     * @return Eccentric Anomaly in [rad] in [0, 2*pi[
      */
     inline double meanAnomalyToEccentricAnomaly(double MA, double e) {
         using namespace detail;
-        double EA = MA + e * std::sin(MA);
-        return normAngle(newtonRaphson(EA, MA, e));
+        //Reduce to [0, pi] and use the symmetry E(-M) = -E(M)
+        double M = std::remainder(MA, PI2);
+        const double sign = M < 0.0 ? -1.0 : 1.0;
+        M = std::abs(M);
+
+        double EA = markleyStarter(M, e);
+
+        //Fifth-order correction (Householder type)
+        const double f2 = e * std::sin(EA);
+        const double f3 = e * std::cos(EA);
+        const double f0 = EA - f2 - M;
+        const double f1 = 1.0 - f3;
+        const double d3 = -f0 / (f1 - 0.5 * f0 * f2 / f1);
+        const double d4 = -f0 / (f1 + 0.5 * d3 * f2 + d3 * d3 * f3 / 6.0);
+        const double d5 = -f0 / (f1 + 0.5 * d4 * f2 + d4 * d4 * f3 / 6.0 - d4 * d4 * d4 * f2 / 24.0);
+        EA += d5;
+
+        //Final Newton polish to remove the remaining rounding error of the correction
+        EA -= (EA - e * std::sin(EA) - M) / (1.0 - e * std::cos(EA));
+
+        return normAngle(sign * EA);
+    }
+
+    /**
+     * Converts many Mean Anomalies to Eccentric Anomalies in parallel (in-place).
+     * @tparam Column - a random access container of double (e.g. a ColumnVector)
+     * @param anomaly - the Mean Anomalies [rad], will contain the Eccentric Anomalies [rad] afterwards
+     * @param eccentricity - the eccentricities
+     */
+    template<typename Column>
+    void meanAnomalyToEccentricAnomaly(Column &anomaly, const Column &eccentricity) {
+        forEachIndex(anomaly.size(), [&](size_t i) {
+            anomaly[i] = meanAnomalyToEccentricAnomaly(anomaly[i], eccentricity[i]);
+        });
     }
 
     /**
@@ -117,4 +160,226 @@ namespace util {
         return thirdRoot / std::pow(fac * meanMotion, twoThird);
     }
 
+
+    /**
+     * Calculates the mean motion of an orbit.
+     * @param a - semi-major-axis [m] (the absolute value is used, so hyperbolic orbits work too)
+     * @return mean motion in [rad/s]
+     */
+    inline double meanMotion(double a) {
+        const double absA = std::abs(a);
+        return std::sqrt(GRAVITATIONAL_PARAMETER_EARTH / (absA * absA * absA));
+    }
+
+    /**
+     * Converts the Hyperbolic Mean Anomaly to the Hyperbolic Anomaly by solving e*sinh(F) - F = N.
+     * @param N - Hyperbolic Mean Anomaly [rad]
+     * @param e - eccentricity (greater one)
+     * @return Hyperbolic Anomaly F [rad]
+     */
+    inline double hyperbolicMeanAnomalyToHyperbolicAnomaly(double N, double e) {
+        //The asinh starter is already close for large |N|, so only a few Newton iterations are required
+        double F = std::asinh(N / e);
+        double term;
+        int maxLoop = 50;
+        do {
+            term = (e * std::sinh(F) - F - N) / (e * std::cosh(F) - 1.0);
+            F -= term;
+        } while (std::abs(term) > 1e-15 * std::max(std::abs(F), 1.0) && --maxLoop);
+        return F;
+    }
+
+    /**
+     * Converts the Gudermannian (the "eccentric anomaly" of hyperbolic orbits used by the OrbitalElements) to the
+     * Hyperbolic Anomaly.
+     * @param zeta - Gudermannian [rad], may be normed to [0, 2*pi[
+     * @return Hyperbolic Anomaly F [rad]
+     */
+    inline double gudermannianToHyperbolicAnomaly(double zeta) {
+        return 2.0 * std::atanh(std::tan(0.5 * std::remainder(zeta, PI2)));
+    }
+
+    /**
+     * Converts the Hyperbolic Anomaly to the Gudermannian.
+     * @param F - Hyperbolic Anomaly [rad]
+     * @return Gudermannian [rad] in [0, 2*pi[
+     */
+    inline double hyperbolicAnomalyToGudermannian(double F) {
+        using namespace detail;
+        return normAngle(2.0 * std::atan(std::tanh(0.5 * F)));
+    }
+
+    /**
+     * Advances the anomaly of an orbit by a time step on the unperturbed two-body trajectory.
+     * @param anomaly - the eccentric anomaly (elliptic) or the Gudermannian (hyperbolic) [rad]
+     * @param a - semi-major-axis [m]
+     * @param e - eccentricity
+     * @param timeStep - time step [s], may be negative
+     * @return the anomaly of the same type after the time step [rad]
+     */
+    inline double propagateAnomaly(double anomaly, double a, double e, double timeStep) {
+        const double n = meanMotion(a);
+        if (e < 1.0) {
+            const double MA = eccentricAnomalyToMeanAnomaly(anomaly, e) + n * timeStep;
+            return meanAnomalyToEccentricAnomaly(MA, e);
+        } else {
+            const double F = gudermannianToHyperbolicAnomaly(anomaly);
+            const double N = e * std::sinh(F) - F + n * timeStep;
+            return hyperbolicAnomalyToGudermannian(hyperbolicMeanAnomalyToHyperbolicAnomaly(N, e));
+        }
+    }
+
+    /**
+     * Calculates the Keplerian Elements from a cartesian position and velocity vector.
+     * This is the computational kernel behind Satellite::getOrbitalElements() and the batch conversion of
+     * OrbitalElementsColumns. It works only on scalars, so it does neither allocate nor create temporary containers.
+     * @param position - cartesian position [m]
+     * @param velocity - cartesian velocity [m/s]
+     * @return array<a, e, i, W, w, eccentric-anomaly> (semi-major-axis positive, eccentric anomaly or in the
+     * hyperbolic case the Gudermannian in [0, 2*pi[)
+     */
+    inline std::array<double, 6> cartesianToKeplerian(const std::array<double, 3> &position,
+                                                      const std::array<double, 3> &velocity) {
+        const double rx = position[0], ry = position[1], rz = position[2];
+        const double vx = velocity[0], vy = velocity[1], vz = velocity[2];
+        std::array<double, 6> keplerianElements{};
+
+        // 1 - We compute h: the orbital angular momentum vector
+        const double hx = ry * vz - rz * vy;
+        const double hy = rz * vx - rx * vz;
+        const double hz = rx * vy - ry * vx;
+        const double hNorm = std::sqrt(hx * hx + hy * hy + hz * hz);
+
+        // 2 - We compute p: the orbital parameter
+        const double p = (hx * hx + hy * hy + hz * hz) / GRAVITATIONAL_PARAMETER_EARTH; // h^2 / mu
+
+        // 3 - We compute n: the vector of the node line (k x h with k = [0, 0, 1])
+        // This operation is singular when inclination is zero, in which case the orbital parameters
+        // are not defined
+        const double nNorm = std::sqrt(hy * hy + hx * hx);
+        const double nx = -hy / nNorm;
+        const double ny = hx / nNorm;
+
+        // 4 - We compute evett: the eccentricity vector
+        const double R0 = std::sqrt(rx * rx + ry * ry + rz * rz);
+        const double ex = (vy * hz - vz * hy) / GRAVITATIONAL_PARAMETER_EARTH - rx / R0;
+        const double ey = (vz * hx - vx * hz) / GRAVITATIONAL_PARAMETER_EARTH - ry / R0;
+        const double ez = (vx * hy - vy * hx) / GRAVITATIONAL_PARAMETER_EARTH - rz / R0;
+
+        // The eccentricity is calculated and stored as the second orbital element
+        const double e = std::sqrt(ex * ex + ey * ey + ez * ez);
+        keplerianElements[1] = e;
+
+        // The semi-major axis (positive quantity) is calculated and stored as the first orbital element
+        keplerianElements[0] = std::abs(p / (1.0 - e * e));
+
+        // Inclination is calculated and stored as the third orbital element
+        keplerianElements[2] = std::acos(hz / hNorm);
+
+        // Argument of pericentrum is calculated and stored as the fifth orbital element
+        keplerianElements[4] = std::acos((nx * ex + ny * ey) / e);
+        if (ez < 0.0) {
+            keplerianElements[4] = PI2 - keplerianElements[4];
+        }
+
+        // Argument of longitude is calculated and stored as the fourth orbital element
+        keplerianElements[3] = std::acos(nx);
+        if (ny < 0.0) {
+            keplerianElements[3] = PI2 - keplerianElements[3];
+        }
+
+        // 4 - We compute ni: the true anomaly (in 0, 2*PI)
+        double ni = std::acos((ex * rx + ey * ry + ez * rz) / e / R0);
+        if (rx * vx + ry * vy + rz * vz < 0.0) {
+            ni = PI2 - ni;
+        }
+
+        // Eccentric anomaly or the gudermannian is calculated and stored as the sixth orbital element
+        // algebraic equivalent of kepler's equation (else case: in terms of the Gudermannian)
+        const double root = e < 1.0 ? (1.0 - e) / (1.0 + e) : (e - 1.0) / (e + 1.0);
+        keplerianElements[5] = 2.0 * std::atan(std::sqrt(root) * std::tan(ni / 2.0));
+
+        //Add 2*pi if the angle is negative in order to norm it to positive values
+        if (keplerianElements[5] < 0) {
+            keplerianElements[5] += PI2;
+        }
+
+        return keplerianElements;
+    }
+
+    /**
+     * Calculates the cartesian position and velocity vector from the Keplerian Elements.
+     * This is the computational kernel behind Satellite::setCartesianByOrbitalElements() and the batch conversion of
+     * OrbitalElementsColumns. It works only on scalars, so it does neither allocate nor create temporary containers.
+     * @param keplerianElements - array<a, e, i, W, w, eccentric-anomaly> (in the hyperbolic case the last element is
+     * the Gudermannian)
+     * @return pair<position [m], velocity [m/s]>
+     */
+    inline std::pair<std::array<double, 3>, std::array<double, 3>>
+    keplerianToCartesian(const std::array<double, 6> &keplerianElements) {
+        double a = keplerianElements[0];
+        const double e = keplerianElements[1];
+        const double i = keplerianElements[2];
+        const double omg = keplerianElements[3];
+        const double omp = keplerianElements[4];
+        const double EA = keplerianElements[5];
+        double xper, yper, xdotper, ydotper;
+
+        // semi-major axis is assumed to be positive here we apply the convention of having it negative as for
+        // computations to result in higher elegance
+        if (e > 1.0) {
+            a = -a;
+        }
+
+        // 1 - We start by evaluating position and velocity in the perifocal reference system
+        const double cosEA = std::cos(EA);
+        if (e < 1.0) {
+            // EA is the eccentric anomaly
+            const double sinEA = std::sin(EA);
+
+            const double b = a * std::sqrt(1.0 - e * e);
+            const double n = std::sqrt(GRAVITATIONAL_PARAMETER_EARTH / (a * a * a));
+
+            xper = a * (cosEA - e);
+            yper = b * sinEA;
+            xdotper = -(a * n * sinEA) / (1.0 - e * cosEA);
+            ydotper = (b * n * cosEA) / (1.0 - e * cosEA);
+        } else {
+            // EA is the Gudermannian
+            const double tanEA = std::tan(EA);
+            const double tanEA_PI_4 = std::tan(0.5 * EA + PI_4);
+
+            const double b = -a * std::sqrt(e * e - 1.0);
+            const double n = std::sqrt((-GRAVITATIONAL_PARAMETER_EARTH) / (a * a * a));
+
+            const double dNdZeta = e * (1.0 + tanEA * tanEA) - (0.5 + 0.5 * tanEA_PI_4 * tanEA_PI_4) / tanEA_PI_4;
+
+            xper = a / cosEA - a * e;
+            yper = b * tanEA;
+
+            xdotper = a * tanEA / cosEA * n / dNdZeta;
+            ydotper = b / cosEA / cosEA * n / dNdZeta;
+        }
+
+        // 2 - We then built the rotation matrix from perifocal reference frame to inertial
+        // Only the first two columns are needed since the perifocal z-component is always zero
+        const double cosomg = std::cos(omg);
+        const double cosomp = std::cos(omp);
+        const double sinomg = std::sin(omg);
+        const double sinomp = std::sin(omp);
+        const double cosi = std::cos(i);
+        const double sini = std::sin(i);
+
+        const double R00 = cosomg * cosomp - sinomg * sinomp * cosi;
+        const double R01 = -cosomg * sinomp - sinomg * cosomp * cosi;
+        const double R10 = sinomg * cosomp + cosomg * sinomp * cosi;
+        const double R11 = -sinomg * sinomp + cosomg * cosomp * cosi;
+        const double R20 = sinomp * sini;
+        const double R21 = cosomp * sini;
+
+        // 3 - We end by transforming according to this rotation matrix
+        return {{R00 * xper + R01 * yper, R10 * xper + R11 * yper, R20 * xper + R21 * yper},
+                {R00 * xdotper + R01 * ydotper, R10 * xdotper + R11 * ydotper, R20 * xdotper + R21 * ydotper}};
+    }
+
 }
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <execution>
+#include <type_traits>
+
+#if defined(BREAKUP_MODEL_HUGE_PAGES) && defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace util {
+
+    /**
+     * Size of a cache line in [byte], used as minimal alignment for the column allocations.
+     */
+    constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * Size of a transparent huge page in [byte] (x86-64 default)
+     */
+    constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /**
+     * Columns with fewer elements than this threshold are first-touched by the calling thread only, because
+     * spawning parallel work for them costs more than it saves.
+     */
+    constexpr size_t FIRST_TOUCH_PARALLEL_THRESHOLD = 1 << 14;
+
+    namespace memory {
+
+        /**
+         * Allocator for the big columns of the SoA structures.
+         * In contrast to the std::allocator it does default-initialize instead of value-initialize elements on
+         * resize(), so the pages of a freshly allocated column are not touched by the (serial) allocating thread.
+         * The pages are placed later by firstTouch(), which writes the initial values in parallel, so that on NUMA
+         * systems each page ends up on the node of the thread which processes it in the later parallel loops.
+         * @note If the project is compiled with BREAKUP_MODEL_HUGE_PAGES (CMake option) then allocations of at
+         * least one huge page are aligned to the huge page size and advised to be backed by transparent huge pages
+         * (Linux only)
+         * @note The allocator lives in its own namespace, so that the iterators of a ColumnVector do not find the
+         * generic container operators of the namespace util by argument dependent lookup
+         * @tparam T - the element type
+         */
+        template<typename T>
+        class FirstTouchAllocator {
+
+        public:
+
+            using value_type = T;
+
+            FirstTouchAllocator() noexcept = default;
+
+            template<typename U>
+            FirstTouchAllocator(const FirstTouchAllocator<U> &) noexcept {}
+
+            /**
+             * Allocates uninitialized memory for n elements.
+             * @param n - number of elements
+             * @return pointer to the memory
+             */
+            T *allocate(size_t n) {
+                const size_t bytes = allocationSize(n);
+                void *memory = ::operator new(bytes, std::align_val_t{alignment(bytes)});
+#if defined(BREAKUP_MODEL_HUGE_PAGES) && defined(__linux__)
+                if (bytes >= HUGE_PAGE_SIZE) {
+                    //Only a hint, the kernel may ignore it --> return value is not of interest
+                    madvise(memory, bytes, MADV_HUGEPAGE);
+                }
+#endif
+                return static_cast<T *>(memory);
+            }
+
+            /**
+             * Frees the memory previously allocated with allocate(n).
+             * @param pointer - the memory
+             * @param n - number of elements
+             */
+            void deallocate(T *pointer, size_t n) noexcept {
+                ::operator delete(pointer, std::align_val_t{alignment(allocationSize(n))});
+            }
+
+            /**
+             * Default-initializes an element (no zeroing for trivial types --> the page is not touched).
+             * @tparam U - the element type
+             * @param pointer - the location
+             */
+            template<typename U>
+            void construct(U *pointer) noexcept(std::is_nothrow_default_constructible_v<U>) {
+                ::new(static_cast<void *>(pointer)) U;
+            }
+
+            /**
+             * Constructs an element with the given arguments.
+             * @tparam U - the element type
+             * @tparam Args - the constructor argument types
+             * @param pointer - the location
+             * @param args - the constructor arguments
+             */
+            template<typename U, typename... Args>
+            void construct(U *pointer, Args &&... args) {
+                ::new(static_cast<void *>(pointer)) U(std::forward<Args>(args)...);
+            }
+
+            friend bool operator==(const FirstTouchAllocator &, const FirstTouchAllocator &) noexcept {
+                return true;
+            }
+
+            friend bool operator!=(const FirstTouchAllocator &, const FirstTouchAllocator &) noexcept {
+                return false;
+            }
+
+        private:
+
+            /**
+             * Returns the number of bytes actually reserved for n elements (rounded up to whole huge pages if huge
+             * pages are enabled and the column is big enough).
+             * @param n - number of elements
+             * @return size in [byte]
+             */
+            static size_t allocationSize(size_t n) noexcept {
+                size_t bytes = n * sizeof(T);
+#if defined(BREAKUP_MODEL_HUGE_PAGES) && defined(__linux__)
+                if (bytes >= HUGE_PAGE_SIZE) {
+                    bytes = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+                }
+#endif
+                return bytes;
+            }
+
+            /**
+             * Returns the alignment for an allocation of a given size.
+             * @param bytes - size in [byte]
+             * @return alignment in [byte]
+             */
+            static size_t alignment([[maybe_unused]] size_t bytes) noexcept {
+#if defined(BREAKUP_MODEL_HUGE_PAGES) && defined(__linux__)
+                if (bytes >= HUGE_PAGE_SIZE) {
+                    return HUGE_PAGE_SIZE;
+                }
+#endif
+                return std::max(CACHE_LINE_SIZE, alignof(T));
+            }
+
+        };
+
+    }
+
+    /**
+     * A std::vector which uses the FirstTouchAllocator. This is the column type of the SoA structures.
+     */
+    template<typename T>
+    using ColumnVector = std::vector<T, memory::FirstTouchAllocator<T>>;
+
+    /**
+     * Writes an initial value (default T{}) to the elements [from, end[ of a column.
+     * Large ranges are written with the same parallel execution policy as the compute loops over these columns use,
+     * so the pages are first-touched by the worker threads instead of the allocating thread.
+     * @tparam Column - a ColumnVector
+     * @param column - the column
+     * @param from - the first element which has not yet been initialized
+     * @param value - the initial value
+     */
+    template<typename Column>
+    void firstTouch(Column &column, size_t from,
+                    const typename Column::value_type &value = typename Column::value_type{}) {
+        using T = typename Column::value_type;
+        //Non-trivial types (e.g. shared_ptr) were already initialized by their default constructor
+        if constexpr (std::is_trivially_default_constructible_v<T>) {
+            if (from >= column.size()) {
+                return;
+            }
+            auto begin = std::next(column.begin(), static_cast<std::ptrdiff_t>(from));
+            if (column.size() - from >= FIRST_TOUCH_PARALLEL_THRESHOLD) {
+                std::fill(std::execution::par_unseq, begin, column.end(), value);
+            } else {
+                std::fill(begin, column.end(), value);
+            }
+        }
+    }
+
+}
@@ -0,0 +1,432 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <algorithm>
+#include <charconv>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <deque>
+#include <limits>
+
+#ifdef BREAKUP_MODEL_ZLIB
+
+#include <zlib.h>
+
+#endif
+
+namespace util {
+
+    namespace detail {
+
+#ifdef BREAKUP_MODEL_ZLIB
+
+        /**
+         * Inflates a deflate-compressed zip entry (raw deflate stream) of a known size.
+         * @param compressed - the compressed data of the entry
+         * @param size - the uncompressed size of the entry
+         * @return the uncompressed data
+         * @throws std::runtime_error if the data is corrupt or does not have the given size
+         */
+        inline std::string inflateZipEntry(std::string_view compressed, size_t size) {
+            z_stream stream{};
+            //Negative window bits select a raw deflate stream without header
+            if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+                throw std::runtime_error{"The zip decompression could not be initialized!"};
+            }
+            std::string inflated(size, '\0');
+            size_t consumed = 0;
+            size_t produced = 0;
+            int result = Z_OK;
+            while (result == Z_OK) {
+                if (stream.avail_in == 0 && consumed < compressed.size()) {
+                    const std::string_view input = compressed.substr(consumed, std::numeric_limits<uInt>::max());
+                    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input.data()));
+                    stream.avail_in = static_cast<uInt>(input.size());
+                    consumed += input.size();
+                }
+                if (stream.avail_out == 0 && produced < size) {
+                    const size_t output = std::min<size_t>(size - produced, std::numeric_limits<uInt>::max());
+                    stream.next_out = reinterpret_cast<Bytef *>(&inflated[produced]);
+                    stream.avail_out = static_cast<uInt>(output);
+                    produced += output;
+                }
+                result = inflate(&stream, Z_NO_FLUSH);
+            }
+            const size_t total = stream.total_out;
+            inflateEnd(&stream);
+            if (result != Z_STREAM_END || total != size) {
+                throw std::runtime_error{"The compressed entry of the .npz archive is corrupt!"};
+            }
+            return inflated;
+        }
+
+#endif
+
+        /**
+         * Returns the NumPy type descriptor (little endian) of an arithmetic type.
+         * @tparam T - double, float or a fixed width integer
+         * @return descriptor, e.g. "<f8" for double
+         */
+        template<typename T>
+        constexpr const char *npyDescriptor();
+
+        template<>
+        constexpr const char *npyDescriptor<double>() { return "<f8"; }
+
+        template<>
+        constexpr const char *npyDescriptor<float>() { return "<f4"; }
+
+        template<>
+        constexpr const char *npyDescriptor<std::uint64_t>() { return "<u8"; }
+
+        template<>
+        constexpr const char *npyDescriptor<std::int64_t>() { return "<i8"; }
+
+        template<>
+        constexpr const char *npyDescriptor<std::uint32_t>() { return "<u4"; }
+
+        template<>
+        constexpr const char *npyDescriptor<std::int32_t>() { return "<i4"; }
+
+    }
+
+    /**
+     * Writes a dense array in the NumPy .npy format (version 1.0, C order), so that it can directly be loaded with
+     * numpy.load().
+     * @tparam T - the element type, see detail::npyDescriptor
+     * @param os - the (binary) output stream
+     * @param data - pointer to the first of the product(shape) elements in C order
+     * @param shape - the dimensions of the array
+     * @note The data is written as it is in memory, so the host needs to be little endian (like x86 and ARM)
+     */
+    template<typename T>
+    void writeNpy(std::ostream &os, const T *data, const std::vector<size_t> &shape) {
+        std::string header{"{'descr': '"};
+        header.append(detail::npyDescriptor<T>()).append("', 'fortran_order': False, 'shape': (");
+        for (size_t dim : shape) {
+            header.append(std::to_string(dim)).append(", ");
+        }
+        //A tuple with one element needs the trailing comma
+        if (shape.size() > 1) {
+            header.erase(header.size() - 2);
+        } else if (!shape.empty()) {
+            header.pop_back();
+        }
+        header.append("), }");
+
+        //Magic string (6) + version (2) + header length (2) + header + '\n' is padded to a multiple of 64 bytes
+        const size_t unpadded = 10 + header.size() + 1;
+        header.append((64 - unpadded % 64) % 64, ' ');
+        header.push_back('\n');
+
+        os.write("\x93NUMPY", 6);
+        os.put(1);
+        os.put(0);
+        os.put(static_cast<char>(header.size() & 0xFFu));
+        os.put(static_cast<char>((header.size() >> 8u) & 0xFFu));
+        os.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+        const size_t count = std::accumulate(shape.begin(), shape.end(), size_t{1}, std::multiplies<>());
+        os.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(count * sizeof(T)));
+    }
+
+    namespace detail {
+
+        /**
+         * Reads a little endian integer at a position.
+         * @tparam T - the unsigned integer type
+         * @param bytes - the buffer
+         * @param position - the offset of the integer
+         * @return the integer
+         * @throws std::runtime_error if the buffer is too short
+         */
+        template<typename T>
+        T readLittleEndian(std::string_view bytes, size_t position) {
+            if (position > bytes.size() || bytes.size() - position < sizeof(T)) {
+                throw std::runtime_error{"Unexpected end of the binary input!"};
+            }
+            T value{};
+            std::memcpy(&value, bytes.substr(position, sizeof(T)).data(), sizeof(T));
+            return value;
+        }
+
+        /**
+         * Converts the elements of a raw buffer from the type Source to T.
+         * @tparam Source - the stored element type
+         * @tparam T - the requested element type
+         * @param data - the raw buffer with count elements
+         * @param count - the number of elements
+         * @return vector of T
+         */
+        template<typename Source, typename T>
+        std::vector<T> convertElements(std::string_view data, size_t count) {
+            std::vector<T> values(count);
+            if constexpr (std::is_same_v<Source, T>) {
+                std::memcpy(values.data(), data.data(), count * sizeof(T));
+            } else {
+                std::vector<Source> source(count);
+                std::memcpy(source.data(), data.data(), count * sizeof(Source));
+                for (size_t i = 0; i < count; ++i) {
+                    values[i] = static_cast<T>(source[i]);
+                }
+            }
+            return values;
+        }
+
+    }
+
+    /**
+     * View on an array in the NumPy .npy format. The data is not copied, it refers to the parsed buffer (e.g. a
+     * memory-mapped file).
+     */
+    struct NpyArray {
+
+        /**
+         * The NumPy type descriptor, e.g. "<f8"
+         */
+        std::string descriptor{};
+
+        /**
+         * The dimensions of the array (C order)
+         */
+        std::vector<size_t> shape{};
+
+        /**
+         * The raw elements
+         */
+        std::string_view data{};
+
+        /**
+         * Returns the number of elements.
+         * @return product of the shape
+         */
+        [[nodiscard]] size_t size() const {
+            return std::accumulate(shape.begin(), shape.end(), size_t{1}, std::multiplies<>());
+        }
+
+        /**
+         * Copies the elements into a vector of T, converting them from the stored type.
+         * @tparam T - the requested arithmetic type
+         * @return the elements in C order
+         * @throws std::runtime_error if the stored type is not supported (supported are little endian floats and
+         * integers of 1, 2, 4 and 8 bytes and booleans)
+         */
+        template<typename T>
+        [[nodiscard]] std::vector<T> toVector() const {
+            const size_t count = this->size();
+            if (descriptor == "<f8") {
+                return detail::convertElements<double, T>(data, count);
+            } else if (descriptor == "<f4") {
+                return detail::convertElements<float, T>(data, count);
+            } else if (descriptor == "<i8") {
+                return detail::convertElements<std::int64_t, T>(data, count);
+            } else if (descriptor == "<u8") {
+                return detail::convertElements<std::uint64_t, T>(data, count);
+            } else if (descriptor == "<i4") {
+                return detail::convertElements<std::int32_t, T>(data, count);
+            } else if (descriptor == "<u4") {
+                return detail::convertElements<std::uint32_t, T>(data, count);
+            } else if (descriptor == "<i2") {
+                return detail::convertElements<std::int16_t, T>(data, count);
+            } else if (descriptor == "<u2") {
+                return detail::convertElements<std::uint16_t, T>(data, count);
+            } else if (descriptor == "|i1") {
+                return detail::convertElements<std::int8_t, T>(data, count);
+            } else if (descriptor == "|u1" || descriptor == "|b1") {
+                return detail::convertElements<std::uint8_t, T>(data, count);
+            }
+            throw std::runtime_error{"The NumPy type " + descriptor + " is not supported!"};
+        }
+
+    };
+
+    /**
+     * Parses an array in the NumPy .npy format (version 1.0 to 3.0).
+     * @param bytes - the content of a .npy file
+     * @return NpyArray referring to bytes
+     * @throws std::runtime_error if the array is malformed, truncated or stored in Fortran order
+     */
+    inline NpyArray parseNpy(std::string_view bytes) {
+        if (bytes.size() < 10 || bytes.substr(0, 6) != "\x93NUMPY") {
+            throw std::runtime_error{"The input is no NumPy array!"};
+        }
+        //Version 1.0 has a 2 byte header length, the later versions a 4 byte one
+        const auto major = static_cast<unsigned char>(bytes[6]);
+        const size_t headerLength = major == 1 ? detail::readLittleEndian<std::uint16_t>(bytes, 8)
+                                               : detail::readLittleEndian<std::uint32_t>(bytes, 8);
+        const size_t headerStart = major == 1 ? 10 : 12;
+        if (bytes.size() < headerStart + headerLength) {
+            throw std::runtime_error{"The NumPy array is truncated!"};
+        }
+        const std::string_view header = bytes.substr(headerStart, headerLength);
+
+        NpyArray array{};
+        auto toSize = [](std::string_view digits) {
+            digits.remove_prefix(std::min(digits.find_first_not_of(' '), digits.size()));
+            size_t value{};
+            const auto result = std::from_chars(digits.data(), std::next(digits.data(), digits.size()), value);
+            if (result.ec != std::errc{}) {
+                throw std::runtime_error{"The NumPy header contains the invalid number " + std::string{digits}};
+            }
+            return value;
+        };
+        auto valueOf = [&header](std::string_view key) {
+            const size_t keyPosition = header.find(key);
+            if (keyPosition == std::string_view::npos) {
+                throw std::runtime_error{"The NumPy header misses the key " + std::string{key}};
+            }
+            return header.substr(header.find(':', keyPosition) + 1);
+        };
+        const std::string_view descriptor = valueOf("'descr'");
+        const size_t descriptorBegin = descriptor.find('\'') + 1;
+        array.descriptor = std::string{descriptor.substr(descriptorBegin,
+                                                         descriptor.find('\'', descriptorBegin) - descriptorBegin)};
+        if (valueOf("'fortran_order'").substr(0, 6).find("True") != std::string_view::npos) {
+            throw std::runtime_error{"NumPy arrays in Fortran order are not supported!"};
+        }
+        std::string_view shape = valueOf("'shape'");
+        shape = shape.substr(shape.find('(') + 1);
+        shape = shape.substr(0, shape.find(')'));
+        while (!shape.empty()) {
+            const size_t separator = std::min(shape.find(','), shape.size());
+            const std::string_view dimension = shape.substr(0, separator);
+            if (dimension.find_first_not_of(' ') != std::string_view::npos) {
+                array.shape.push_back(toSize(dimension));
+            }
+            shape.remove_prefix(std::min(separator + 1, shape.size()));
+        }
+
+        const size_t itemSize = toSize(std::string_view{array.descriptor}.substr(std::min(size_t{2},
+                                                                                           array.descriptor.size())));
+        const size_t dataSize = array.size() * itemSize;
+        if (bytes.size() - headerStart - headerLength < dataSize) {
+            throw std::runtime_error{"The NumPy array is truncated!"};
+        }
+        array.data = bytes.substr(headerStart + headerLength, dataSize);
+        return array;
+    }
+
+    /**
+     * Returns the entries of a NumPy .npz archive (a zip file as written by numpy.savez, ZIP64 included).
+     * Stored entries are not copied, they refer to bytes. Deflate-compressed entries (numpy.savez_compressed) are
+     * inflated into inflatedEntries if the program is built with zlib.
+     * @param bytes - the content of a .npz file
+     * @param inflatedEntries - receives the inflated entries, must live as long as the returned views
+     * @return mapping from the array name (without the .npy ending) to the content of the .npy entry
+     * @throws std::runtime_error if the archive is malformed or an entry is compressed with another method or
+     * without zlib support
+     */
+    inline std::map<std::string, std::string_view>
+    parseNpz(std::string_view bytes, [[maybe_unused]] std::deque<std::string> &inflatedEntries) {
+        using detail::readLittleEndian;
+        //The End of Central Directory record is at the end of the file (followed by a comment of at most 64 KiB)
+        constexpr std::uint32_t END_SIGNATURE = 0x06054b50;
+        if (bytes.size() < 22) {
+            throw std::runtime_error{"The input is no NumPy .npz archive!"};
+        }
+        size_t end = bytes.size() - 22;
+        while (readLittleEndian<std::uint32_t>(bytes, end) != END_SIGNATURE) {
+            if (end == 0 || bytes.size() - end > 22 + 0xFFFF) {
+                throw std::runtime_error{"The input is no NumPy .npz archive!"};
+            }
+            --end;
+        }
+        std::uint64_t entryCount = readLittleEndian<std::uint16_t>(bytes, end + 10);
+        std::uint64_t directoryOffset = readLittleEndian<std::uint32_t>(bytes, end + 16);
+        if (entryCount == 0xFFFF || directoryOffset == 0xFFFFFFFF) {
+            //ZIP64: The locator directly precedes the End of Central Directory record
+            if (end < 20 || readLittleEndian<std::uint32_t>(bytes, end - 20) != 0x07064b50) {
+                throw std::runtime_error{"The ZIP64 locator of the .npz archive is missing!"};
+            }
+            const size_t end64 = readLittleEndian<std::uint64_t>(bytes, end - 20 + 8);
+            if (readLittleEndian<std::uint32_t>(bytes, end64) != 0x06064b50) {
+                throw std::runtime_error{"The ZIP64 record of the .npz archive is malformed!"};
+            }
+            entryCount = readLittleEndian<std::uint64_t>(bytes, end64 + 32);
+            directoryOffset = readLittleEndian<std::uint64_t>(bytes, end64 + 48);
+        }
+
+        std::map<std::string, std::string_view> entries{};
+        size_t position = directoryOffset;
+        for (std::uint64_t entry = 0; entry < entryCount; ++entry) {
+            if (readLittleEndian<std::uint32_t>(bytes, position) != 0x02014b50) {
+                throw std::runtime_error{"The central directory of the .npz archive is malformed!"};
+            }
+            const auto method = readLittleEndian<std::uint16_t>(bytes, position + 10);
+            std::uint64_t size = readLittleEndian<std::uint32_t>(bytes, position + 20);
+            std::uint64_t uncompressedSize = readLittleEndian<std::uint32_t>(bytes, position + 24);
+            const size_t nameLength = readLittleEndian<std::uint16_t>(bytes, position + 28);
+            const size_t extraLength = readLittleEndian<std::uint16_t>(bytes, position + 30);
+            const size_t commentLength = readLittleEndian<std::uint16_t>(bytes, position + 32);
+            std::uint64_t localOffset = readLittleEndian<std::uint32_t>(bytes, position + 42);
+            const std::string_view name = bytes.substr(position + 46, nameLength);
+
+            //The ZIP64 extra field holds the values which are saturated in the fixed fields (in this order)
+            const bool uncompressedSaturated = uncompressedSize == 0xFFFFFFFF;
+            size_t extra = position + 46 + nameLength;
+            const size_t extraEnd = extra + extraLength;
+            while (extra + 4 <= extraEnd) {
+                const auto id = readLittleEndian<std::uint16_t>(bytes, extra);
+                const size_t length = readLittleEndian<std::uint16_t>(bytes, extra + 2);
+                if (id == 0x0001) {
+                    size_t field = extra + 4;
+                    if (uncompressedSaturated) {
+                        uncompressedSize = readLittleEndian<std::uint64_t>(bytes, field);
+                        field += 8;
+                    }
+                    if (size == 0xFFFFFFFF) {
+                        size = readLittleEndian<std::uint64_t>(bytes, field);
+                        field += 8;
+                    }
+                    if (localOffset == 0xFFFFFFFF) {
+                        localOffset = readLittleEndian<std::uint64_t>(bytes, field);
+                    }
+                }
+                extra += 4 + length;
+            }
+
+            //0: stored (numpy.savez), 8: deflate (numpy.savez_compressed)
+            if (method != 0 && method != 8) {
+                throw std::runtime_error{"The entry " + std::string{name} + " of the .npz archive is compressed "
+                                         "with the unsupported method " + std::to_string(method) + "!"};
+            }
+#ifndef BREAKUP_MODEL_ZLIB
+            if (method == 8) {
+                throw std::runtime_error{"The entry " + std::string{name} + " of the .npz archive is compressed "
+                                         "(numpy.savez_compressed), but the program was built without zlib!"};
+            }
+#endif
+            if (readLittleEndian<std::uint32_t>(bytes, localOffset) != 0x04034b50) {
+                throw std::runtime_error{"The local header of the .npz archive is malformed!"};
+            }
+            const size_t dataOffset = localOffset + 30 + readLittleEndian<std::uint16_t>(bytes, localOffset + 26)
+                                      + readLittleEndian<std::uint16_t>(bytes, localOffset + 28);
+            if (dataOffset > bytes.size() || bytes.size() - dataOffset < size) {
+                throw std::runtime_error{"The .npz archive is truncated!"};
+            }
+            std::string key{name};
+            if (key.size() > 4 && key.compare(key.size() - 4, 4, ".npy") == 0) {
+                key.erase(key.size() - 4);
+            }
+            if (method == 0) {
+                entries.emplace(std::move(key), bytes.substr(dataOffset, size));
+            } else {
+#ifdef BREAKUP_MODEL_ZLIB
+                inflatedEntries.push_back(detail::inflateZipEntry(bytes.substr(dataOffset, size), uncompressedSize));
+                entries.emplace(std::move(key), std::string_view{inflatedEntries.back()});
+#endif
+            }
+            position += 46 + nameLength + extraLength + commentLength;
+        }
+        return entries;
+    }
+
+}
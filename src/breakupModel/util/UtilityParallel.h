@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <execution>
+
+namespace util {
+
+    /**
+     * The iterator lives in its own namespace, so that it does not find the generic container operators of the
+     * namespace util by argument dependent lookup.
+     */
+    namespace parallel {
+
+        /**
+         * Random access iterator over the indices [0, size[ without storing them (a counting iterator).
+         * This allows to run the std::execution algorithms over the element indices of several columns at once.
+         */
+        class IndexIterator {
+
+            size_t _index{0};
+
+        public:
+
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = size_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const size_t *;
+            using reference = size_t;
+
+            IndexIterator() = default;
+
+            explicit IndexIterator(size_t index)
+                    : _index{index} {}
+
+            reference operator*() const {
+                return _index;
+            }
+
+            reference operator[](difference_type n) const {
+                return _index + n;
+            }
+
+            IndexIterator &operator++() {
+                ++_index;
+                return *this;
+            }
+
+            IndexIterator operator++(int) {
+                IndexIterator copy{*this};
+                ++_index;
+                return copy;
+            }
+
+            IndexIterator &operator--() {
+                --_index;
+                return *this;
+            }
+
+            IndexIterator operator--(int) {
+                IndexIterator copy{*this};
+                --_index;
+                return copy;
+            }
+
+            IndexIterator &operator+=(difference_type n) {
+                _index += n;
+                return *this;
+            }
+
+            IndexIterator &operator-=(difference_type n) {
+                _index -= n;
+                return *this;
+            }
+
+            friend IndexIterator operator+(IndexIterator it, difference_type n) {
+                return it += n;
+            }
+
+            friend IndexIterator operator+(difference_type n, IndexIterator it) {
+                return it += n;
+            }
+
+            friend IndexIterator operator-(IndexIterator it, difference_type n) {
+                return it -= n;
+            }
+
+            friend difference_type operator-(const IndexIterator &lhs, const IndexIterator &rhs) {
+                return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+            }
+
+            friend bool operator==(const IndexIterator &lhs, const IndexIterator &rhs) {
+                return lhs._index == rhs._index;
+            }
+
+            friend bool operator!=(const IndexIterator &lhs, const IndexIterator &rhs) {
+                return lhs._index != rhs._index;
+            }
+
+            friend bool operator<(const IndexIterator &lhs, const IndexIterator &rhs) {
+                return lhs._index < rhs._index;
+            }
+
+            friend bool operator>(const IndexIterator &lhs, const IndexIterator &rhs) {
+                return lhs._index > rhs._index;
+            }
+
+            friend bool operator<=(const IndexIterator &lhs, const IndexIterator &rhs) {
+                return lhs._index <= rhs._index;
+            }
+
+            friend bool operator>=(const IndexIterator &lhs, const IndexIterator &rhs) {
+                return lhs._index >= rhs._index;
+            }
+
+        };
+
+    }
+
+    /**
+     * Applies a function to every index in [0, size[ in parallel (std::execution::par_unseq).
+     * The function must therefore be free of data races between different indices.
+     * @tparam Function - a callable taking a size_t
+     * @param size - the number of indices
+     * @param function - the function to apply
+     */
+    template<typename Function>
+    void forEachIndex(size_t size, Function function) {
+        std::for_each(std::execution::par_unseq, parallel::IndexIterator{0}, parallel::IndexIterator{size}, function);
+    }
+
+}
@@ -47,7 +47,7 @@ int main(int argc, char *argv[]) {
         //Prints the the output to files defined by the OutputConfigurationSource aka the YAMLConfigurationReader
         auto outputTargets = configSource->getOutputTargets();
         for (auto &out : outputTargets) {
-            out->printResult(breakUpSimulation->getResult());
+            out->printResult(*breakUpSimulation);
         }
         //Print output for the input defined by the OutputConfigurationSource aka the YAMLConfigurationReader
         auto inputTargets = configSource->getInputTargets();
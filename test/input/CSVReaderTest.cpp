@@ -3,6 +3,8 @@
 #include <string>
 #include <array>
 #include <tuple>
+#include <fstream>
+#include <filesystem>
 #include "breakupModel/input/CSVReader.h"
 #include "breakupModel/model/Satellite.h"
 
@@ -99,3 +101,30 @@ TEST_F(CSVReaderTest, readExampleVeryWrong) {
                                                                  "SatType";
 
 }
+
+/**
+ * Many lines are split into several chunks, the order of the file must be kept and reading stops at the first empty line
+ */
+TEST_F(CSVReaderTest, readManyLines) {
+    const std::string path = (std::filesystem::temp_directory_path() / "CSVReaderTestMany.csv").string();
+    {
+        std::ofstream file{path};
+        file << "ID,Name,Value\n";
+        for (int i = 0; i < 10000; ++i) {
+            file << i << ",Object " << i << ",+" << i << ".5\n";
+        }
+        file << "10000,Empty,\n\n10001,Ignored,1.0\n";
+    }
+
+    CSVReader<size_t, std::string, double> csvReader{path, true};
+
+    auto actualTuple = csvReader.getLines();
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(actualTuple.size(), 10001);
+    for (size_t i = 0; i < 10000; ++i) {
+        ASSERT_EQ(actualTuple[i], std::make_tuple(i, "Object " + std::to_string(i), static_cast<double>(i) + 0.5))
+                                    << "i=" << i;
+    }
+    ASSERT_EQ(actualTuple[10000], std::make_tuple(size_t{10000}, std::string{"Empty"}, 0.0));
+}
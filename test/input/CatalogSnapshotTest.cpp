@@ -0,0 +1,144 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <filesystem>
+#include <cmath>
+#include <fstream>
+#include "breakupModel/input/CatalogSnapshot.h"
+#include "breakupModel/input/TLESatcatDataReader.h"
+
+namespace {
+
+/**
+ * Source which must not be read because the snapshot is up to date
+ */
+class ThrowingSource : public DataSource {
+
+public:
+
+    void forEachSatelliteBatch(size_t, const SatelliteBatchVisitor &) const override {
+        throw std::runtime_error{"The source must not be read!"};
+    }
+
+};
+
+}
+
+/**
+ * The restored satellites must be identical to the ones of the wrapped reader
+ */
+TEST(CatalogSnapshotTest, WriteAndRestore) {
+    const std::string snapshotPath{(std::filesystem::temp_directory_path() / "CatalogSnapshotTest01.bin").string()};
+    std::filesystem::remove(snapshotPath);
+    const std::vector<std::string> inputFiles{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest01.txt"};
+    auto reader = std::make_shared<TLESatcatDataReader>(inputFiles[0], inputFiles[1]);
+    CatalogSnapshot catalogSnapshot{snapshotPath, inputFiles, std::nullopt, reader};
+
+    const auto expected = reader->getSatelliteCollection();
+    const auto first = catalogSnapshot.getSatelliteCollection();
+    ASSERT_TRUE(std::filesystem::exists(snapshotPath));
+
+    //This snapshot cannot read its source, so the satellites can only be restored from the file
+    const CatalogSnapshot restoring{snapshotPath, inputFiles, std::nullopt, std::make_shared<ThrowingSource>()};
+    const auto restored = restoring.getSatelliteCollection();
+    ASSERT_EQ(restored.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const auto &lhs = expected[i];
+        const auto &rhs = restored[i];
+        ASSERT_EQ(lhs.getId(), rhs.getId());
+        ASSERT_EQ(lhs.getName(), rhs.getName());
+        ASSERT_EQ(lhs.getSatType(), rhs.getSatType());
+        ASSERT_EQ(lhs.getMass(), rhs.getMass());
+        ASSERT_EQ(lhs.getArea(), rhs.getArea());
+        ASSERT_EQ(lhs.getCharacteristicLength(), rhs.getCharacteristicLength());
+        //A/M is NaN for an RCS of zero
+        ASSERT_EQ(std::isnan(lhs.getAreaToMassRatio()), std::isnan(rhs.getAreaToMassRatio()));
+        ASSERT_TRUE(std::isnan(lhs.getAreaToMassRatio()) || lhs.getAreaToMassRatio() == rhs.getAreaToMassRatio());
+        ASSERT_EQ(lhs.getPosition(), rhs.getPosition());
+        ASSERT_EQ(lhs.getVelocity(), rhs.getVelocity());
+        ASSERT_EQ(lhs.getOrbitalElements(), rhs.getOrbitalElements());
+        ASSERT_EQ(first[i].getId(), lhs.getId());
+    }
+
+    //Another propagation epoch results in another key, so the snapshot is not restored
+    const CatalogSnapshot otherEpoch{snapshotPath, inputFiles, Epoch{2021, 200.0}, std::make_shared<ThrowingSource>()};
+    ASSERT_NE(otherEpoch.computeKey(), catalogSnapshot.computeKey());
+    ASSERT_THROW(otherEpoch.getSatelliteCollection(), std::runtime_error);
+
+    //Without a snapshot file the source is read
+    const CatalogSnapshot missing{snapshotPath + ".missing", inputFiles, std::nullopt,
+                                  std::make_shared<ThrowingSource>()};
+    ASSERT_THROW(missing.getSatelliteCollection(), std::runtime_error);
+    std::filesystem::remove(snapshotPath);
+}
+
+/**
+ * The filtered satellites and the maximal ID are read from an up to date snapshot without the wrapped source
+ */
+TEST(CatalogSnapshotTest, FilterAndMaximalIDFromSnapshot) {
+    const std::string snapshotPath{(std::filesystem::temp_directory_path() / "CatalogSnapshotTest02.bin").string()};
+    std::filesystem::remove(snapshotPath);
+    const std::vector<std::string> inputFiles{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest01.txt"};
+    auto reader = std::make_shared<TLESatcatDataReader>(inputFiles[0], inputFiles[1]);
+    const auto expected = reader->getSatelliteCollection();
+    ASSERT_GE(expected.size(), 2);
+    CatalogSnapshot{snapshotPath, inputFiles, std::nullopt, reader}.getSatelliteCollection();
+
+    const CatalogSnapshot catalogSnapshot{snapshotPath, inputFiles, std::nullopt, std::make_shared<ThrowingSource>()};
+    const std::set<size_t> idFilter{expected.front().getId(), expected.back().getId()};
+    const auto filtered = catalogSnapshot.getFilteredSatelliteCollection(idFilter);
+    ASSERT_EQ(filtered.size(), 2);
+    ASSERT_EQ(filtered.front().getId(), expected.front().getId());
+    ASSERT_EQ(filtered.back().getId(), expected.back().getId());
+    ASSERT_EQ(filtered.back().getName(), expected.back().getName());
+    ASSERT_EQ(catalogSnapshot.getMaximalID(), reader->getMaximalID());
+
+    //Identical inputs give byte-identical snapshots (no uninitialized padding)
+    const std::string otherPath{snapshotPath + ".copy"};
+    CatalogSnapshot{otherPath, inputFiles, std::nullopt, reader}.getSatelliteCollection();
+    const util::MappedFile lhs{snapshotPath};
+    const util::MappedFile rhs{otherPath};
+    ASSERT_EQ(lhs.view(), rhs.view());
+
+    std::filesystem::remove(snapshotPath);
+    std::filesystem::remove(otherPath);
+}
+
+/**
+ * A corrupt record whose key still matches makes the snapshot stale, the satellites are read from the source again
+ */
+TEST(CatalogSnapshotTest, CorruptRecordIsStale) {
+    const std::string snapshotPath{(std::filesystem::temp_directory_path() / "CatalogSnapshotTest03.bin").string()};
+    std::filesystem::remove(snapshotPath);
+    const std::vector<std::string> inputFiles{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest01.txt"};
+    auto reader = std::make_shared<TLESatcatDataReader>(inputFiles[0], inputFiles[1]);
+    const CatalogSnapshot catalogSnapshot{snapshotPath, inputFiles, std::nullopt, reader};
+    const auto expected = catalogSnapshot.getSatelliteCollection();
+
+    auto overwrite = [&snapshotPath](std::streamoff position, const auto &value) {
+        std::fstream file{snapshotPath, std::ios::in | std::ios::out | std::ios::binary};
+        file.seekp(position);
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+    auto assertRestored = [&expected](const std::vector<Satellite> &restored) {
+        ASSERT_EQ(restored.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(restored[i].getId(), expected[i].getId());
+            ASSERT_EQ(restored[i].getName(), expected[i].getName());
+            ASSERT_EQ(restored[i].getSatType(), expected[i].getSatType());
+        }
+    };
+
+    //The header has 40 bytes, the name length of the first record is at byte 16 of the record
+    overwrite(40 + 16, std::uint64_t{1000000});
+    assertRestored(catalogSnapshot.getSatelliteCollection());
+
+    //The SatType of the first record is at byte 188 of the record (the snapshot was rewritten in between)
+    overwrite(40 + 188, std::uint8_t{42});
+    assertRestored(catalogSnapshot.getSatelliteCollection());
+    assertRestored(catalogSnapshot.getSatelliteCollection());
+
+    std::filesystem::remove(snapshotPath);
+}
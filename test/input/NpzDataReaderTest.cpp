@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+
+#include <array>
+#include <vector>
+#include "breakupModel/input/NpzDataReader.h"
+#include "breakupModel/model/SatelliteBuilder.h"
+
+/**
+ * Archive 01 contains three satellites with cartesian state (the position stored as float32),
+ * archive 02 one satellite given by area and Kepler elements
+ */
+TEST(NpzDataReaderTest, getSatelliteCollectionCartesian) {
+    NpzDataReader npzReader{"resources/NpzDataReaderTest01.npz"};
+
+    auto satellites = npzReader.getSatelliteCollection();
+
+    ASSERT_EQ(satellites.size(), 3);
+    const std::vector<size_t> expectedIDs{24946, 24947, 24948};
+    const std::vector<SatType> expectedTypes{SatType::SPACECRAFT, SatType::ROCKET_BODY, SatType::DEBRIS};
+    const std::vector<double> expectedMass{700.0, 900.0, 50.0};
+    const std::vector<std::array<double, 3>> expectedPosition{{0, 0, 0}, {10, 20, 30}, {-1, -2, -3}};
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        ASSERT_EQ(satellites[i].getId(), expectedIDs[i]);
+        ASSERT_EQ(satellites[i].getSatType(), expectedTypes[i]);
+        ASSERT_DOUBLE_EQ(satellites[i].getMass(), expectedMass[i]);
+        ASSERT_EQ(satellites[i].getPosition(), expectedPosition[i]);
+        const double v = static_cast<double>(i + 1);
+        ASSERT_EQ(satellites[i].getVelocity(), (std::array<double, 3>{v, v, v}));
+    }
+}
+
+/**
+ * Archive 03 contains the arrays of archive 01 deflate-compressed (like numpy.savez_compressed)
+ */
+TEST(NpzDataReaderTest, getSatelliteCollectionCompressed) {
+    NpzDataReader npzReader{"resources/NpzDataReaderTest03.npz"};
+#ifdef BREAKUP_MODEL_ZLIB
+    const auto expected = NpzDataReader{"resources/NpzDataReaderTest01.npz"}.getSatelliteCollection();
+
+    auto satellites = npzReader.getSatelliteCollection();
+
+    ASSERT_EQ(satellites.size(), expected.size());
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        ASSERT_EQ(satellites[i].getId(), expected[i].getId());
+        ASSERT_EQ(satellites[i].getSatType(), expected[i].getSatType());
+        ASSERT_EQ(satellites[i].getMass(), expected[i].getMass());
+        ASSERT_EQ(satellites[i].getPosition(), expected[i].getPosition());
+        ASSERT_EQ(satellites[i].getVelocity(), expected[i].getVelocity());
+    }
+#else
+    ASSERT_THROW(npzReader.getSatelliteCollection(), std::runtime_error);
+#endif
+}
+
+TEST(NpzDataReaderTest, getSatelliteCollectionKepler) {
+    NpzDataReader npzReader{"resources/NpzDataReaderTest02.npz"};
+    const OrbitalElements elements{{6798505.86, 0.0002215, 0.9013735469, 4.724103630312, 2.237100203348,
+                                    0.2405604761}};
+    SatelliteBuilder satelliteBuilder{};
+    const Satellite expected = satelliteBuilder.setID(7).setMassByArea(3.5).setOrbitalElements(elements).getResult();
+
+    auto satellites = npzReader.getSatelliteCollection();
+
+    ASSERT_EQ(satellites.size(), 1);
+    ASSERT_EQ(satellites[0].getId(), 7);
+    ASSERT_EQ(satellites[0].getSatType(), SatType::SPACECRAFT);
+    ASSERT_DOUBLE_EQ(satellites[0].getMass(), expected.getMass());
+    ASSERT_EQ(satellites[0].getOrbitalElements(), elements);
+    for (size_t j = 0; j < 3; ++j) {
+        ASSERT_NEAR(satellites[0].getPosition()[j], expected.getPosition()[j], 1e-6);
+        ASSERT_NEAR(satellites[0].getVelocity()[j], expected.getVelocity()[j], 1e-9);
+    }
+}
+
+TEST(NpzDataReaderTest, malformedInput) {
+    ASSERT_THROW(NpzDataReader{"resources/NotExisting.npz"}, std::runtime_error);
+    NpzDataReader noArchive{"resources/TLEReaderTest01.txt"};
+    ASSERT_THROW(noArchive.getSatelliteCollection(), std::runtime_error);
+}
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <filesystem>
+#include <fstream>
+#include <cstdint>
+#include "breakupModel/input/TLEHistory.h"
+
+/**
+ * The file contains the ISS three times (epochs 2008 day 264.5, 270 and 260 in this order of the file)
+ * and the ID 5 once
+ */
+class TLEHistoryTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        _history = TLEHistory{TLEReader{"resources/TLEHistoryTest01.txt"}.getTLEColumns()};
+    }
+
+    TLEHistory _history;
+
+};
+
+TEST_F(TLEHistoryTest, getEntriesSortedByEpoch) {
+    ASSERT_EQ(_history.size(), 4);
+    ASSERT_EQ(_history.getIDCount(), 2);
+    ASSERT_TRUE(_history.contains(5));
+    ASSERT_FALSE(_history.contains(6));
+
+    auto entries = _history.getEntries(25544);
+    ASSERT_EQ(entries.size(), 3);
+    ASSERT_DOUBLE_EQ(entries[0].orbitalElements.getEpoch().fraction, 260.0);
+    ASSERT_DOUBLE_EQ(entries[1].orbitalElements.getEpoch().fraction, 264.51782528);
+    ASSERT_DOUBLE_EQ(entries[2].orbitalElements.getEpoch().fraction, 270.0);
+    ASSERT_DOUBLE_EQ(entries[0].orbitalElements.getInclination(AngularUnit::DEGREE), 51.6400);
+    ASSERT_DOUBLE_EQ(entries[2].orbitalElements.getInclination(AngularUnit::DEGREE), 51.6430);
+
+    ASSERT_TRUE(_history.getEntries(6).empty());
+}
+
+TEST_F(TLEHistoryTest, getClosestEntry) {
+    auto closestFraction = [this](size_t id, double fraction) {
+        return _history.getClosestEntry(id, Epoch{2008, fraction})->orbitalElements.getEpoch().fraction;
+    };
+    ASSERT_DOUBLE_EQ(closestFraction(25544, 100.0), 260.0);
+    ASSERT_DOUBLE_EQ(closestFraction(25544, 262.0), 260.0);
+    ASSERT_DOUBLE_EQ(closestFraction(25544, 263.0), 264.51782528);
+    ASSERT_DOUBLE_EQ(closestFraction(25544, 268.0), 270.0);
+    ASSERT_DOUBLE_EQ(closestFraction(25544, 365.0), 270.0);
+    ASSERT_DOUBLE_EQ(closestFraction(5, 1.0), 264.51782528);
+    ASSERT_FALSE(_history.getClosestEntry(6, Epoch{2008, 1.0}).has_value());
+
+    auto columns = _history.getClosestColumns(Epoch{2008, 269.0});
+    ASSERT_EQ(columns.id, (std::vector<size_t>{5, 25544}));
+    ASSERT_DOUBLE_EQ(columns.epoch[1].fraction, 270.0);
+}
+
+TEST_F(TLEHistoryTest, saveAndLoad) {
+    const std::string path = (std::filesystem::temp_directory_path() / "TLEHistoryTest.bin").string();
+    _history.save(path);
+    const auto loaded = TLEHistory::load(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(loaded.size(), _history.size());
+    ASSERT_EQ(loaded.getIDCount(), _history.getIDCount());
+    const auto expected = _history.getEntries(25544);
+    const auto actual = loaded.getEntries(25544);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        ASSERT_EQ(actual[i].orbitalElements, expected[i].orbitalElements);
+        ASSERT_DOUBLE_EQ(actual[i].bstar, expected[i].bstar);
+    }
+
+    ASSERT_THROW(TLEHistory::load("resources/TLEHistoryTest01.txt"), std::runtime_error);
+}
+
+TEST_F(TLEHistoryTest, loadCorruptOffsets) {
+    const std::string path = (std::filesystem::temp_directory_path() / "TLEHistoryTestCorrupt.bin").string();
+    //The header has 32 bytes, it is followed by the two IDs {5, 25544} and then the three offsets {0, 1, 4}
+    auto overwrite = [&path](size_t index, std::uint64_t value) {
+        std::fstream file{path, std::ios::in | std::ios::out | std::ios::binary};
+        file.seekp(static_cast<std::streamoff>(32 + index * sizeof(std::uint64_t)));
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+    constexpr size_t firstOffset = 2;
+
+    //Decreasing offsets (the last one is still the number of entries)
+    _history.save(path);
+    overwrite(firstOffset + 1, 5);
+    ASSERT_THROW(TLEHistory::load(path), std::runtime_error);
+
+    //The first offset must be zero
+    _history.save(path);
+    overwrite(firstOffset, 1);
+    ASSERT_THROW(TLEHistory::load(path), std::runtime_error);
+
+    //Equal offsets mean an ID without entries
+    _history.save(path);
+    overwrite(firstOffset + 1, 0);
+    ASSERT_THROW(TLEHistory::load(path), std::runtime_error);
+
+    //The IDs must be strictly ascending
+    _history.save(path);
+    overwrite(1, 5);
+    ASSERT_THROW(TLEHistory::load(path), std::runtime_error);
+    _history.save(path);
+    overwrite(0, 30000);
+    ASSERT_THROW(TLEHistory::load(path), std::runtime_error);
+
+    _history.save(path);
+    ASSERT_NO_THROW(TLEHistory::load(path));
+    std::filesystem::remove(path);
+}
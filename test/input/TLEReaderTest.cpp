@@ -86,3 +86,41 @@ TEST_F(TLEReaderTest, readTLE_04_Test) {
     ASSERT_EQ(actualKepler, _expectedKepler_3);
 }
 
+
+TEST_F(TLEReaderTest, readTLE_Bstar_Test) {
+    TLEReader tleReader{"resources/TLEReaderTest01.txt"};
+
+    auto map = tleReader.getMappingIDTLEEntries();
+
+    ASSERT_EQ(map.size(), 1);
+    ASSERT_EQ(map.count(_expectedID_1), 1);
+    ASSERT_EQ(map.at(_expectedID_1).orbitalElements, _expectedKepler_1);
+    ASSERT_DOUBLE_EQ(map.at(_expectedID_1).bstar, -0.11606e-4);
+}
+
+TEST_F(TLEReaderTest, readTLE_BlankBstar_Test) {
+    //The first entry has a blank B* field, the line one of the second entry ends in front of it
+    TLEReader tleReader{"resources/TLEReaderTest05.txt"};
+
+    auto map = tleReader.getMappingIDTLEEntries();
+
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.at(_expectedID_1).orbitalElements, _expectedKepler_1);
+    ASSERT_EQ(map.at(_expectedID_1).bstar, 0.0);
+    ASSERT_EQ(map.at(_expectedID_1 + 1).bstar, 0.0);
+}
+
+TEST_F(TLEReaderTest, readTLE_Columns_Test) {
+    TLEReader tleReader{"resources/TLEReaderTest03.txt"};
+
+    auto columns = tleReader.getTLEColumns();
+    auto map = tleReader.getMappingIDTLEEntries();
+
+    ASSERT_GE(columns.size(), map.size());
+    ASSERT_EQ(columns.orbitalElements.size(), columns.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+        ASSERT_EQ(map.count(columns.id[i]), 1);
+    }
+    ASSERT_EQ(columns.getEntry(0).orbitalElements, map.at(columns.id[0]).orbitalElements);
+    ASSERT_EQ(columns.getEntry(0).bstar, map.at(columns.id[0]).bstar);
+}
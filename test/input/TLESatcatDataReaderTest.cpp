@@ -170,3 +170,111 @@ TEST_F(TLESatcatDataReaderTest, getSatelliteCollectionNoPartner) {
 
     ASSERT_EQ(actualSatellites.size(), 0);
 }
+
+TEST_F(TLESatcatDataReaderTest, getSatelliteCollectionPropagated) {
+    //All four entries have the same TLE (ISS, epoch 2008 264.51782528) --> propagate them one day
+    TLESatcatDataReader tleSatcatDataReader{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest01.txt",
+                                            Epoch{2008, 265.51782528}};
+
+    auto actualSatellites = tleSatcatDataReader.getSatelliteCollection();
+
+    ASSERT_EQ(actualSatellites.size(), 4);
+    for (size_t i = 0; i < actualSatellites.size(); ++i) {
+        ASSERT_EQ(actualSatellites[i], _expectedSatellites[i]);
+        ASSERT_EQ(actualSatellites[i].getPosition(), actualSatellites[0].getPosition());
+        ASSERT_NE(actualSatellites[i].getPosition(), _expectedSatellites[i].getPosition());
+        //Still in the same orbit (the ISS semi-major-axis is about 6730 km)
+        ASSERT_NEAR(actualSatellites[i].getOrbitalElements().getSemiMajorAxis(), 6730000.0, 20000.0);
+    }
+}
+
+TEST_F(TLESatcatDataReaderTest, getMaximalIDPropagated) {
+    //The satellite with ID 4 has a huge drag term B* and decays until the propagation epoch
+    TLESatcatDataReader tleSatcatDataReader{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest05.txt",
+                                            Epoch{2008, 294.51782528}};
+
+    auto actualSatellites = tleSatcatDataReader.getSatelliteCollection();
+
+    ASSERT_EQ(actualSatellites.size(), 3);
+    ASSERT_EQ(actualSatellites.back().getId(), 3);
+    ASSERT_EQ(tleSatcatDataReader.getMaximalID(), 3);
+}
+
+TEST_F(TLESatcatDataReaderTest, getFilteredSatelliteCollection) {
+    TLESatcatDataReader tleSatcatDataReader{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest01.txt"};
+
+    auto actualSatellites = tleSatcatDataReader.getFilteredSatelliteCollection({2, 4, 99});
+
+    ASSERT_EQ(actualSatellites.size(), 2);
+    ASSERT_EQ(actualSatellites[0], _expectedSatellites[1]);
+    ASSERT_EQ(actualSatellites[0].getName(), _expectedSatellites[1].getName());
+    ASSERT_EQ(actualSatellites[0].getPosition(), _expectedSatellites[1].getPosition());
+    ASSERT_EQ(actualSatellites[1], _expectedSatellites[3]);
+
+    //The maximal ID refers to all satellites, not only the filtered ones
+    ASSERT_EQ(tleSatcatDataReader.getMaximalID(), 4);
+}
+
+TEST_F(TLESatcatDataReaderTest, forEachSatelliteBatch) {
+    TLESatcatDataReader tleSatcatDataReader{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest01.txt"};
+
+    std::vector<size_t> batchSizes{};
+    std::vector<Satellite> actualSatellites{};
+    tleSatcatDataReader.forEachSatelliteBatch(3, [&](std::vector<Satellite> &batch) {
+        batchSizes.push_back(batch.size());
+        actualSatellites.insert(actualSatellites.end(), batch.begin(), batch.end());
+    });
+
+    ASSERT_EQ(batchSizes, (std::vector<size_t>{3, 1}));
+    ASSERT_EQ(actualSatellites.size(), _expectedSatellites.size());
+    for (size_t i = 0; i < actualSatellites.size(); ++i) {
+        ASSERT_EQ(actualSatellites[i], _expectedSatellites[i]);
+        ASSERT_EQ(actualSatellites[i].getName(), _expectedSatellites[i].getName());
+        ASSERT_EQ(actualSatellites[i].getPosition(), _expectedSatellites[i].getPosition());
+    }
+}
+
+TEST_F(TLESatcatDataReaderTest, getSatelliteCollectionCompressed) {
+#ifdef BREAKUP_MODEL_ZLIB
+    TLESatcatDataReader tleSatcatDataReader{"resources/SatcatReaderTest01.csv.gz",
+                                            "resources/TLESatcatReaderTest01.txt.gz"};
+
+    auto actualSatellites = tleSatcatDataReader.getSatelliteCollection();
+
+    ASSERT_EQ(actualSatellites.size(), _expectedSatellites.size());
+    for (size_t i = 0; i < actualSatellites.size(); ++i) {
+        ASSERT_EQ(actualSatellites[i], _expectedSatellites[i]);
+        ASSERT_EQ(actualSatellites[i].getName(), _expectedSatellites[i].getName());
+        ASSERT_EQ(actualSatellites[i].getPosition(), _expectedSatellites[i].getPosition());
+    }
+#else
+    GTEST_SKIP() << "Built without zlib";
+#endif
+}
+
+TEST_F(TLESatcatDataReaderTest, updateCatalog) {
+    TLESatcatDataReader tleSatcatDataReader{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest02.txt"};
+    Catalog catalog = tleSatcatDataReader.getCatalog();
+    ASSERT_EQ(catalog.size(), 3);
+
+    //ID 2 gets a new element set, ID 3 is new, ID 9 is not contained in the satcat
+    const auto touched = tleSatcatDataReader.updateCatalog(catalog, "resources/TLESatcatUpdateTest01.txt");
+    ASSERT_EQ(touched, (std::vector<size_t>{1, 3}));
+    ASSERT_EQ(catalog.size(), 4);
+    ASSERT_EQ(catalog.id[3], 3);
+    ASSERT_EQ(catalog.getName(3), "SPUTNIK 2");
+    ASSERT_EQ(catalog.satType[3], SatType::SPACECRAFT);
+    ASSERT_NEAR(catalog.area[3], 0.08, 1e-12);
+    ASSERT_NEAR(catalog.orbitalElements.inclination[1], util::degToRad(98.0), 1e-12);
+    ASSERT_DOUBLE_EQ(catalog.epoch[1].fraction, 265.0);
+
+    //The untouched objects and the satcat fields of the updated ones stay the same
+    ASSERT_NEAR(catalog.orbitalElements.inclination[0], util::degToRad(51.6416), 1e-12);
+    ASSERT_EQ(catalog.getName(1), "SPUTNIK 1");
+
+    //The updated catalog equals a catalog read with the updated TLE file
+    const auto satellites = catalog.getSatellites({3});
+    ASSERT_EQ(satellites[0].getPosition(), _expectedSatellites[2].getPosition());
+
+    ASSERT_THROW(tleSatcatDataReader.updateCatalog(catalog, "resources/NotExisting.txt"), std::runtime_error);
+}
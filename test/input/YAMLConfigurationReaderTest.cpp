@@ -14,6 +14,9 @@ TEST(YAMLConfigurationReaderTest, ConfigTest01_Normal) {
     EXPECT_EQ(yamlReader.getTypeOfSimulation(), SimulationType::COLLISION);
     EXPECT_EQ(yamlReader.getCurrentMaximalGivenID().value(), 48514);
     EXPECT_EQ(yamlReader.getIDFilter().value(), expectedIDFilter);
+    EXPECT_EQ(yamlReader.getPropagationEpoch().value().year, 2008);
+    EXPECT_EQ(yamlReader.getPropagationEpoch().value().fraction, 264.5);
+    EXPECT_EQ(yamlReader.getCullingAltitude().value(), 100000.0);
 
 
     EXPECT_EQ(yamlReader.getInputTargets().size(), 1);
@@ -29,6 +32,8 @@ TEST(YAMLConfigurationReaderTest, ConfigTest02_Normal) {
     EXPECT_EQ(yamlReader.getTypeOfSimulation(), SimulationType::COLLISION);
     EXPECT_EQ(yamlReader.getCurrentMaximalGivenID(), std::nullopt);
     EXPECT_EQ(yamlReader.getIDFilter().value(), expectedIDFilter);
+    EXPECT_FALSE(yamlReader.getPropagationEpoch().has_value());
+    EXPECT_FALSE(yamlReader.getCullingAltitude().has_value());
 
 
     EXPECT_EQ(yamlReader.getInputTargets().size(), 0);
@@ -59,3 +64,16 @@ TEST(YAMLConfigurationReaderTest, ConfigTest05_NoSimTag) {
                                         "an exception";
 }
 
+
+TEST(YAMLConfigurationReaderTest, ConfigTest06_Histogram) {
+    YAMLConfigurationReader yamlReader{"resources/YamlConfigurationReaderTest05.yaml"};
+
+    EXPECT_EQ(yamlReader.getOutputTargets().size(), 2) << "Only csv and npy are available for histograms";
+    EXPECT_THROW(yamlReader.getInputTargets(), std::runtime_error) << "The histogram type is unknown";
+}
+
+TEST(YAMLConfigurationReaderTest, ConfigTest07_DensityGrid) {
+    YAMLConfigurationReader yamlReader{"resources/YamlConfigurationReaderTest06.yaml"};
+
+    EXPECT_EQ(yamlReader.getOutputTargets().size(), 2) << "Only csv and npy are available for density grids";
+}
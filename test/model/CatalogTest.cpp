@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+#include <set>
+#include "breakupModel/model/Catalog.h"
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/SatelliteBuilder.h"
+#include "breakupModel/input/TLESatcatDataReader.h"
+
+/**
+ * Identical names are saved only once, new objects have an empty name
+ */
+TEST(CatalogTest, NameInterning) {
+    Catalog catalog{4, false};
+    catalog.setName(0, "COSMOS 2251 DEB");
+    catalog.setName(1, "IRIDIUM 33 DEB");
+    catalog.setName(2, "COSMOS 2251 DEB");
+
+    ASSERT_EQ(catalog.getName(0), "COSMOS 2251 DEB");
+    ASSERT_EQ(catalog.getName(1), "IRIDIUM 33 DEB");
+    ASSERT_EQ(catalog.getName(2), "COSMOS 2251 DEB");
+    ASSERT_EQ(catalog.getName(3), "");
+    //The empty name and two distinct names
+    ASSERT_EQ(catalog.getNameCount(), 3);
+
+    //Satellites with the same name share the name string
+    const auto satellites = catalog.getSatellites();
+    ASSERT_EQ(satellites.size(), 4);
+    ASSERT_EQ(satellites[0].getName(), "COSMOS 2251 DEB");
+    ASSERT_EQ(&satellites[0].getName(), &satellites[2].getName());
+    ASSERT_EQ(satellites[3].getName(), "");
+}
+
+TEST(CatalogTest, AppendAndConvertBack) {
+    SatelliteBuilder satelliteBuilder{};
+    std::vector<Satellite> satellites{
+            satelliteBuilder.reset().setID(7).setName("A").setSatType(SatType::DEBRIS).setMassByArea(0.5)
+                    .setPosition({7.0e6, 0.0, 0.0}).setVelocity({0.0, 7500.0, 0.0}).getResult(),
+            satelliteBuilder.reset().setID(3).setName("B").setSatType(SatType::ROCKET_BODY).setMassByArea(10.0)
+                    .setPosition({0.0, 7.1e6, 0.0}).setVelocity({-7400.0, 0.0, 0.0}).getResult()
+    };
+
+    Catalog catalog{};
+    catalog.append(satellites);
+    ASSERT_EQ(catalog.size(), 2);
+    ASSERT_FALSE(catalog.hasOrbitalElements());
+    ASSERT_EQ(catalog.findIndices({3, 99}), (std::vector<size_t>{1}));
+
+    const auto actual = catalog.getSatellites();
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        ASSERT_EQ(actual[i].getId(), satellites[i].getId());
+        ASSERT_EQ(actual[i].getName(), satellites[i].getName());
+        ASSERT_EQ(actual[i].getSatType(), satellites[i].getSatType());
+        ASSERT_EQ(actual[i].getMass(), satellites[i].getMass());
+        ASSERT_EQ(actual[i].getAreaToMassRatio(), satellites[i].getAreaToMassRatio());
+        ASSERT_EQ(actual[i].getPosition(), satellites[i].getPosition());
+        ASSERT_EQ(actual[i].getVelocity(), satellites[i].getVelocity());
+    }
+
+    Catalog withOrbitalElements{1, true};
+    ASSERT_THROW(withOrbitalElements.append(satellites), std::runtime_error);
+}
+
+/**
+ * The Catalog of the TLE/ satcat input keeps the Orbital Elements, the conversion yields the same Satellites
+ */
+TEST(CatalogTest, TLESatcatCatalog) {
+    TLESatcatDataReader reader{"resources/SatcatReaderTest01.csv", "resources/TLESatcatReaderTest01.txt"};
+    SatelliteBuilder satelliteBuilder{};
+
+    const Catalog catalog = reader.getCatalog();
+    ASSERT_TRUE(catalog.hasOrbitalElements());
+    ASSERT_EQ(catalog.size(), 4);
+    ASSERT_EQ(catalog.getName(0), "SL-1 R/B");
+
+    const auto indices = catalog.findIndices({2, 4});
+    ASSERT_EQ(indices, (std::vector<size_t>{1, 3}));
+    const auto satellites = catalog.getSatellites(indices);
+    const Satellite expected = satelliteBuilder.reset().setID(4).setName("EXPLORER 1").setMassByArea(0)
+            .setOrbitalElements(OrbitalElements{catalog.orbitalElements.getElement(3).getAsArray(), catalog.epoch[3]})
+            .getResult();
+    ASSERT_EQ(satellites[1].getId(), 4);
+    ASSERT_EQ(satellites[1].getName(), "EXPLORER 1");
+    ASSERT_EQ(satellites[1].getPosition(), expected.getPosition());
+    ASSERT_EQ(satellites[1].getVelocity(), expected.getVelocity());
+    ASSERT_EQ(satellites[1].getOrbitalElements().getEpoch().toJulianDate(), catalog.epoch[3].toJulianDate());
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/OrbitalElementsFactory.h"
+#include <array>
+#include <vector>
+
+/**
+ * The batch conversion must yield exactly the same Orbital Elements like the conversion of a single Satellite
+ */
+TEST(OrbitalElementsColumnsTest, FromCartesianEqualsSingleConversion) {
+    Satellites satellites{1, SatType::DEBRIS, {-7.0e6, 2.0e6, 1.0e6}, 4};
+    satellites.velocity[0] = {-1000.0, -7000.0, 1500.0};
+    satellites.velocity[1] = {2000.0, -6500.0, -3000.0};
+    satellites.velocity[2] = {-500.0, -8500.0, 200.0};
+    satellites.velocity[3] = {100.0, -5000.0, 4000.0};
+
+    auto columns = OrbitalElementsColumns::fromCartesian(satellites);
+    auto aos = satellites.getAoS();
+
+    ASSERT_EQ(columns.size(), satellites.size());
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        ASSERT_EQ(columns.getElement(i), aos[i].getOrbitalElements());
+    }
+    ASSERT_EQ(columns.getAoS().size(), satellites.size());
+}
+
+TEST(OrbitalElementsColumnsTest, ResizeZeroInitializes) {
+    OrbitalElementsColumns columns{3};
+    columns.setElement(1, {7.0e6, 0.1, 0.2, 0.3, 0.4, 0.5});
+    columns.resize(5);
+
+    ASSERT_EQ(columns.size(), 5);
+    ASSERT_EQ(columns.getElement(1).getAsArray(), (std::array<double, 6>{7.0e6, 0.1, 0.2, 0.3, 0.4, 0.5}));
+    ASSERT_EQ(columns.getElement(4).getAsArray(), (std::array<double, 6>{}));
+}
+
+/**
+ * The batch conversion is checked against reference states (same values like in SatelliteTest)
+ */
+TEST(OrbitalElementsColumnsTest, ToCartesianReferenceStates) {
+    OrbitalElementsFactory factory{};
+    //METEOSAT-11 (MSG4) and METEOSAT-10 (MSG3)
+    const std::vector<OrbitalElements> orbitalElements{
+            factory.createOrbitalElements(42165260.2513, 0.00006880,
+                                          0.1709691, AngularUnit::DEGREE,
+                                          130.8922575, AngularUnit::DEGREE,
+                                          341.0477201, AngularUnit::DEGREE,
+                                          184.6690779, AngularUnit::DEGREE, OrbitalAnomalyType::TRUE),
+            factory.createOrbitalElements(42165127.2712, 0.00017770,
+                                          1.22945, AngularUnit::DEGREE,
+                                          14.390738, AngularUnit::DEGREE,
+                                          106.7172695, AngularUnit::DEGREE,
+                                          185.0791856, AngularUnit::DEGREE, OrbitalAnomalyType::TRUE)
+    };
+    const std::vector<std::array<double, 3>> expectedPosition{{18887167.8187, -37701817.738, 31043.7678},
+                                                              {24897525.3639, -34028444.5369, -840177.9325}};
+    const std::vector<std::array<double, 3>> expectedVelocity{{2748.7608, 1377.0359, -8.8903},
+                                                              {2481.1036, 1814.7995, 24.492}};
+
+    auto [position, velocity] = OrbitalElementsColumns::fromAoS(orbitalElements).toCartesian();
+
+    ASSERT_EQ(position.size(), orbitalElements.size());
+    for (size_t i = 0; i < orbitalElements.size(); ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            //Abs error for unit meter (high, because of imprecise input data! Therefore +/- 1km)
+            ASSERT_NEAR(position[i][j], expectedPosition[i][j], 1000) << "i = " << i << ", j = " << j;
+            ASSERT_NEAR(velocity[i][j], expectedVelocity[i][j], 1) << "i = " << i << ", j = " << j;
+        }
+    }
+}
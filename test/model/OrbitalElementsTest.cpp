@@ -96,4 +96,14 @@ TEST(OrbitalElementsTest, Epoch02) {
     EXPECT_EQ(actualTm.tm_mon, expectedTm.tm_mon);
     EXPECT_EQ(actualTm.tm_yday, expectedTm.tm_yday);
     EXPECT_EQ(actualTm.tm_year, expectedTm.tm_year);
-}
\ No newline at end of file
+}
+
+TEST(OrbitalElementsTest, EpochSecondsUntil) {
+    Epoch epoch{2008, 264.5};
+
+    EXPECT_DOUBLE_EQ(epoch.secondsUntil(Epoch{2008, 265.0}), 43200.0);
+    EXPECT_DOUBLE_EQ(epoch.secondsUntil(Epoch{2008, 264.0}), -43200.0);
+    //2008 is a leap year
+    EXPECT_DOUBLE_EQ(epoch.secondsUntil(Epoch{2009, 264.5}), 366.0 * 86400.0);
+    EXPECT_DOUBLE_EQ(Epoch(2000, 1.5).toJulianDate(), 2451545.0);
+}
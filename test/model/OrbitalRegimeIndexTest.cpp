@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <set>
+#include <random>
+#include "breakupModel/model/OrbitalRegimeIndex.h"
+#include "breakupModel/model/Catalog.h"
+#include "breakupModel/util/UtilityFunctions.h"
+#include "breakupModel/util/UtilityKepler.h"
+
+class OrbitalRegimeIndexTest : public ::testing::Test {
+
+protected:
+
+    void SetUp() override {
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<double> perigee{200.0e3, 2000.0e3};
+        std::uniform_real_distribution<double> eccentricity{0.0, 0.2};
+        std::uniform_real_distribution<double> inclination{0.0, util::PI};
+        std::uniform_int_distribution<int> satType{0, 3};
+
+        _catalog.resize(1000, true);
+        for (size_t i = 0; i < _catalog.size(); ++i) {
+            const double e = eccentricity(generator);
+            const double a = (util::EARTH_RADIUS + perigee(generator)) / (1.0 - e);
+            _catalog.id[i] = 1000 + i;
+            _catalog.satType[i] = static_cast<SatType>(satType(generator));
+            _catalog.orbitalElements.setElement(i, {a, e, inclination(generator), 1.0, 2.0, 3.0});
+        }
+    }
+
+    /**
+     * The positions of the objects inside the regime by a full scan
+     */
+    std::vector<size_t> scan(const OrbitalRegimeQuery &query) const {
+        std::vector<size_t> positions{};
+        for (size_t i = 0; i < _catalog.size(); ++i) {
+            const double a = _catalog.orbitalElements.semiMajorAxis[i];
+            const double e = _catalog.orbitalElements.eccentricity[i];
+            const double inclination = _catalog.orbitalElements.inclination[i];
+            const double perigee = a * (1.0 - e) - util::EARTH_RADIUS;
+            const double apogee = a * (1.0 + e) - util::EARTH_RADIUS;
+            if (perigee >= query.minimalPerigeeAltitude && perigee <= query.maximalPerigeeAltitude &&
+                apogee >= query.minimalApogeeAltitude && apogee <= query.maximalApogeeAltitude &&
+                inclination >= query.minimalInclination && inclination <= query.maximalInclination &&
+                (!query.satType.has_value() || _catalog.satType[i] == query.satType.value())) {
+                positions.push_back(i);
+            }
+        }
+        return positions;
+    }
+
+    Catalog _catalog{};
+
+};
+
+TEST_F(OrbitalRegimeIndexTest, FindEqualsScan) {
+    const OrbitalRegimeIndex index{_catalog};
+    ASSERT_EQ(index.size(), _catalog.size());
+
+    //Rocket bodies with perigee 700-900 km and inclination 98-99 deg
+    OrbitalRegimeQuery sunSynchronous{};
+    sunSynchronous.minimalPerigeeAltitude = 700.0e3;
+    sunSynchronous.maximalPerigeeAltitude = 900.0e3;
+    sunSynchronous.minimalInclination = util::degToRad(98.0);
+    sunSynchronous.maximalInclination = util::degToRad(99.0);
+    sunSynchronous.satType = SatType::ROCKET_BODY;
+    ASSERT_EQ(index.find(sunSynchronous), scan(sunSynchronous));
+
+    OrbitalRegimeQuery wide{};
+    wide.minimalPerigeeAltitude = 500.0e3;
+    wide.maximalApogeeAltitude = 1500.0e3;
+    wide.minimalInclination = util::degToRad(30.0);
+    wide.maximalInclination = util::degToRad(100.0);
+    const auto expected = scan(wide);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(index.find(wide), expected);
+
+    std::set<size_t> expectedIDs{};
+    for (const size_t position : expected) {
+        expectedIDs.insert(_catalog.id[position]);
+    }
+    ASSERT_EQ(index.findIDs(wide), expectedIDs);
+
+    //Everything and nothing
+    ASSERT_EQ(index.find(OrbitalRegimeQuery{}).size(), _catalog.size());
+    OrbitalRegimeQuery empty{};
+    empty.minimalInclination = 1.0;
+    empty.maximalInclination = 0.5;
+    ASSERT_TRUE(index.find(empty).empty());
+}
+
+/**
+ * The index over the Satellites (cartesian state) finds the same objects like the one over the Orbital Elements
+ */
+TEST_F(OrbitalRegimeIndexTest, SatellitesEqualCatalog) {
+    const OrbitalRegimeIndex catalogIndex{_catalog};
+    const OrbitalRegimeIndex satelliteIndex{_catalog.getSatellites()};
+
+    OrbitalRegimeQuery query{};
+    query.minimalPerigeeAltitude = 400.0e3;
+    query.maximalPerigeeAltitude = 1200.0e3;
+    query.minimalInclination = util::degToRad(45.0);
+    query.maximalInclination = util::degToRad(120.0);
+    ASSERT_EQ(satelliteIndex.findIDs(query), catalogIndex.findIDs(query));
+}
+
+TEST_F(OrbitalRegimeIndexTest, DegenerateStateIsSkipped) {
+    //A zero state vector has no Orbital Elements (NaN), it is neither bucketed nor found
+    Catalog catalog{3, false};
+    catalog.id[0] = 1;
+    catalog.id[1] = 2;
+    catalog.id[2] = 3;
+    auto [position, velocity] = util::keplerianToCartesian({util::EARTH_RADIUS + 800.0e3, 0.01, 1.0, 0.0, 0.0, 0.0});
+    catalog.position[0] = position;
+    catalog.velocity[0] = velocity;
+    catalog.position[1] = {0.0, 0.0, 0.0};
+    catalog.velocity[1] = {0.0, 0.0, 0.0};
+    catalog.position[2] = position;
+    catalog.velocity[2] = velocity;
+    const OrbitalRegimeIndex index{catalog};
+
+    ASSERT_EQ(index.size(), 2);
+    ASSERT_EQ(index.findIDs(OrbitalRegimeQuery{}), (std::set<size_t>{1, 3}));
+    ASSERT_EQ(index.find(OrbitalRegimeQuery{}), (std::vector<size_t>{0, 2}));
+
+    OrbitalRegimeQuery nanQuery{};
+    nanQuery.minimalInclination = std::numeric_limits<double>::quiet_NaN();
+    ASSERT_TRUE(index.findIDs(nanQuery).empty());
+}
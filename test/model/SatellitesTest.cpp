@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+
+#include <array>
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+
+/**
+ * By default all Satellites share the base position and no position column is allocated
+ */
+TEST(SatellitesTest, SharedPosition) {
+    Satellites satellites{1, SatType::DEBRIS, {1.0, 2.0, 3.0}, 3};
+
+    ASSERT_FALSE(satellites.hasFragmentPositions());
+    ASSERT_TRUE(satellites.fragmentPosition.empty());
+    for (const auto &sat : satellites.getAoS()) {
+        ASSERT_EQ(sat.getPosition(), satellites.position);
+    }
+}
+
+/**
+ * After materializing, the positions can diverge and getAoS() and resize() respect the individual positions
+ */
+TEST(SatellitesTest, FragmentPositions) {
+    const std::array<double, 3> base{1.0, 2.0, 3.0};
+    Satellites satellites{1, SatType::DEBRIS, base, 3};
+
+    satellites.materializeFragmentPositions();
+    ASSERT_TRUE(satellites.hasFragmentPositions());
+    ASSERT_EQ(satellites.fragmentPosition.size(), 3);
+    satellites.fragmentPosition[1] = {4.0, 5.0, 6.0};
+
+    satellites.resize(4);
+    ASSERT_EQ(satellites.fragmentPosition.size(), 4);
+    ASSERT_EQ(satellites.getPosition(3), base);
+
+    auto aos = satellites.getAoS();
+    ASSERT_EQ(aos[0].getPosition(), base);
+    ASSERT_EQ(aos[1].getPosition(), (std::array<double, 3>{4.0, 5.0, 6.0}));
+
+    satellites.prependElement();
+    ASSERT_EQ(satellites.getPosition(4), base);
+}
+
+/**
+ * The Orbital Elements are calculated once, shared between the calls and discarded on resize
+ */
+TEST(SatellitesTest, KeplerColumnsCached) {
+    Satellites satellites{1, SatType::DEBRIS, {-7.0e6, 2.0e6, 1.0e6}, 2};
+    satellites.velocity[0] = {-1000.0, -7000.0, 1500.0};
+    satellites.velocity[1] = {2000.0, -6500.0, -3000.0};
+
+    auto keplerColumns = satellites.getKeplerColumns();
+    ASSERT_EQ(keplerColumns, satellites.getKeplerColumns());
+    ASSERT_EQ(keplerColumns->size(), 2);
+
+    auto aos = satellites.getAoS();
+    for (size_t i = 0; i < aos.size(); ++i) {
+        const auto elements = aos[i].getOrbitalElements();
+        ASSERT_EQ(keplerColumns->orbitalElements.getElement(i), elements);
+        ASSERT_EQ(keplerColumns->meanAnomaly[i], elements.getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::MEAN));
+        ASSERT_EQ(keplerColumns->trueAnomaly[i], elements.getAnomaly(AngularUnit::RADIAN, OrbitalAnomalyType::TRUE));
+    }
+
+    satellites.resize(3);
+    ASSERT_NE(keplerColumns, satellites.getKeplerColumns());
+    ASSERT_EQ(satellites.getKeplerColumns()->size(), 3);
+}
+
+/**
+ * The compaction keeps the order of the remaining elements
+ */
+TEST(SatellitesTest, RemoveIf) {
+    Satellites satellites{1, SatType::DEBRIS, {1.0, 2.0, 3.0}, 5};
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        satellites.mass[i] = static_cast<double>(i);
+        satellites.velocity[i] = {static_cast<double>(i), 0.0, 0.0};
+    }
+
+    ASSERT_EQ(satellites.removeIf([](size_t i) { return i % 2 == 1; }), 2);
+    ASSERT_EQ(satellites.size(), 3);
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        ASSERT_EQ(satellites.mass[i], 2.0 * static_cast<double>(i));
+        ASSERT_EQ(satellites.velocity[i][0], 2.0 * static_cast<double>(i));
+    }
+}
@@ -2,8 +2,11 @@
 
 #include <filesystem>
 #include <vector>
+#include <sstream>
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/Satellites.h"
 #include "breakupModel/output/CSVPatternWriter.h"
+#include "spdlog/sinks/ostream_sink.h"
 #include "breakupModel/input/CSVReader.h"
 
 class CSVPatternWriterTest : public ::testing::Test {
@@ -120,4 +123,31 @@ TEST_F(CSVPatternWriterTest, DataCheck) {
 
         ++line;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * Printing the SoA with the cached Orbital Elements must give exactly the same lines like printing the vector
+ */
+TEST_F(CSVPatternWriterTest, SoAEqualsAoS) {
+    Satellites satellites{1, SatType::DEBRIS, {-7.0e6, 2.0e6, 1.0e6}, 3};
+    satellites.velocity[0] = {-1000.0, -7000.0, 1500.0};
+    satellites.velocity[1] = {2000.0, -6500.0, -3000.0};
+    satellites.velocity[2] = {-500.0, -8500.0, 200.0};
+    const std::string pattern{"IaeiWwMET"};
+
+    std::ostringstream aosStream{};
+    std::ostringstream soaStream{};
+    {
+        auto aosLogger = std::make_shared<spdlog::logger>(
+                "CSVPatternWriterAoS", std::make_shared<spdlog::sinks::ostream_sink_st>(aosStream));
+        auto soaLogger = std::make_shared<spdlog::logger>(
+                "CSVPatternWriterSoA", std::make_shared<spdlog::sinks::ostream_sink_st>(soaStream));
+        CSVPatternWriter aosWriter{aosLogger, pattern};
+        CSVPatternWriter soaWriter{soaLogger, pattern};
+        aosWriter.printResult(satellites.getAoS());
+        soaWriter.printResult(satellites);
+    }
+
+    ASSERT_FALSE(soaStream.str().empty());
+    ASSERT_EQ(soaStream.str(), aosStream.str());
+}
@@ -6,6 +6,7 @@
 #include "breakupModel/output/CSVWriter.h"
 #include "breakupModel/input/CSVReader.h"
 #include "breakupModel/model/Satellite.h"
+#include "breakupModel/model/OrbitalElementsFactory.h"
 
 class CSVWriterTest : public ::testing::Test {
 
@@ -123,3 +124,34 @@ TEST_F(CSVWriterTest, DataCheck) {
         ++line;
     }
 }
+
+TEST_F(CSVWriterTest, KeplerCheckTLEElements) {
+    //A circular equatorial orbit (like a GEO satellite): W and w cannot be derived from the cartesian state again
+    const auto expectedElements =
+            OrbitalElementsFactory{}.createFromTLEData({1.00271173, 0.0, 0.0, 120.0, 30.0, 45.0}, Epoch{2021, 1.0});
+    Satellite satellite{"GEO", SatType::SPACECRAFT};
+    satellite.setId(1);
+    satellite.setCartesianByOrbitalElements(expectedElements);
+
+    auto csvTestLogger = spdlog::basic_logger_mt("CSVWriterTest", _filePath, true);
+    CSVWriter csvWriter{csvTestLogger, true};
+
+    csvWriter.printResult(std::vector<Satellite>{satellite});
+    csvTestLogger->flush();
+
+    CSVReader<size_t, std::string, SatType,
+            double, double, double, double,
+            std::string, std::string, std::string,
+            double, double, double, double, double, double> csvReader{_filePath, true};
+
+    const auto lines = csvReader.getLines();
+    ASSERT_EQ(lines.size(), 1);
+    const auto expected = expectedElements.getAsArray();
+    const auto &line = lines.front();
+    ASSERT_DOUBLE_EQ(std::get<10>(line), expected[0]);
+    ASSERT_DOUBLE_EQ(std::get<11>(line), expected[1]);
+    ASSERT_DOUBLE_EQ(std::get<12>(line), expected[2]);
+    ASSERT_DOUBLE_EQ(std::get<13>(line), expected[3]);
+    ASSERT_DOUBLE_EQ(std::get<14>(line), expected[4]);
+    ASSERT_DOUBLE_EQ(std::get<15>(line), expected[5]);
+}
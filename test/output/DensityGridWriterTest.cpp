@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/output/DensityGridWriter.h"
+
+class DensityGridWriterTest : public ::testing::Test {
+
+protected:
+
+    /**
+     * Returns the sum of density times shell volume, i.e. the number of objects in the grid.
+     */
+    static double objectCount(const util::Grid3D &grid) {
+        static constexpr double earthRadius = util::EARTH_RADIUS / 1000.0;
+        double count = 0.0;
+        for (size_t i = 0; i < grid.getBins(0); ++i) {
+            const double inner = earthRadius + grid.getLowerEdge(0, i);
+            const double outer = earthRadius + grid.getLowerEdge(0, i + 1);
+            const double volume = 4.0 / 3.0 * util::PI * (outer * outer * outer - inner * inner * inner);
+            for (size_t j = 0; j < grid.getBins(1); ++j) {
+                for (size_t k = 0; k < grid.getBins(2); ++k) {
+                    count += grid.getValue(i, j, k) * volume;
+                }
+            }
+        }
+        return count;
+    }
+
+    virtual void TearDown() {
+        try {
+            std::filesystem::remove(_filePath);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    const std::string _filePath{"resources/densityGridTestFile.csv"};
+
+    //Inclination 51.6 deg
+    const double _cosI = std::cos(util::degToRad(51.6));
+
+    const double _sinI = std::sin(util::degToRad(51.6));
+
+};
+
+/**
+ * A circular orbit stays in one shell, so the whole object is in one bin
+ */
+TEST_F(DensityGridWriterTest, CircularOrbit) {
+    const double radius = util::EARTH_RADIUS + 810000.0;
+    const double speed = std::sqrt(util::GRAVITATIONAL_PARAMETER_EARTH / radius);
+    Satellites satellites{1, SatType::DEBRIS, {radius, 0.0, 0.0}, 1};
+    satellites.velocity[0] = {0.0, speed * _cosI, speed * _sinI};
+
+    DensityGridWriter writer{_filePath};
+    auto grid = writer.createGrid(satellites);
+
+    //810 km altitude --> shell [800, 820[, 51.6 deg --> [50, 55[
+    EXPECT_GT(grid.getValue(30, 10, 0), 0.0);
+    EXPECT_NEAR(objectCount(grid), 1.0, 1e-9);
+    EXPECT_NEAR(grid.getValue(30, 10, 0) * 4.0 / 3.0 * util::PI *
+                (std::pow(util::EARTH_RADIUS / 1000.0 + 820.0, 3) - std::pow(util::EARTH_RADIUS / 1000.0 + 800.0, 3)),
+                1.0, 1e-9);
+}
+
+/**
+ * An elliptic orbit is spread over all shells between perigee and apogee, the time fractions sum up to one.
+ * The hyperbolic fragment does not contribute.
+ */
+TEST_F(DensityGridWriterTest, EllipticAndHyperbolicOrbit) {
+    const double radius = util::EARTH_RADIUS + 500000.0;
+    Satellites satellites{1, SatType::DEBRIS, {radius, 0.0, 0.0}, 2};
+    satellites.velocity[0] = {0.0, 7900.0 * _cosI, 7900.0 * _sinI};
+    satellites.velocity[1] = {0.0, 12000.0 * _cosI, 12000.0 * _sinI};
+
+    DensityGridWriter writer{_filePath};
+    auto grid = writer.createGrid(satellites);
+    auto elements = satellites.getAoS()[0].getOrbitalElements();
+    const double apogee =
+            (elements.getSemiMajorAxis() * (1.0 + elements.getEccentricity()) - util::EARTH_RADIUS) / 1000.0;
+
+    EXPECT_NEAR(objectCount(grid), 1.0, 1e-9);
+    EXPECT_GT(grid.getValue(15, 10, 0), 0.0) << "Perigee shell";
+    EXPECT_GT(grid.getValue(static_cast<size_t>((apogee - 200.0) / 20.0), 10, 0), 0.0) << "Apogee shell";
+    //More time is spent near the apogee than near the perigee
+    EXPECT_GT(grid.getValue(static_cast<size_t>((apogee - 200.0) / 20.0), 10, 0), grid.getValue(16, 10, 0));
+    EXPECT_EQ(writer.createGrid(satellites.getAoS()).getValues(), grid.getValues());
+}
+
+TEST_F(DensityGridWriterTest, CsvOutput) {
+    const double radius = util::EARTH_RADIUS + 810000.0;
+    const double speed = std::sqrt(util::GRAVITATIONAL_PARAMETER_EARTH / radius);
+    Satellites satellites{1, SatType::DEBRIS, {radius, 0.0, 0.0}, 1};
+    satellites.velocity[0] = {0.0, speed * _cosI, speed * _sinI};
+
+    DensityGridWriter writer{_filePath};
+    writer.printResult(satellites);
+
+    std::ifstream file{_filePath};
+    std::string header{};
+    std::string line{};
+    std::getline(file, header);
+    std::getline(file, line);
+
+    EXPECT_EQ(header.substr(0, 20), "Altitude lower [km],");
+    EXPECT_EQ(line.substr(0, 18), "800,820,50,55,0,36");
+    EXPECT_FALSE(std::getline(file, line)) << "Only one bin is not empty";
+}
@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/output/HistogramWriter.h"
+
+class HistogramWriterTest : public ::testing::Test {
+
+protected:
+
+    virtual void SetUp() {
+        //Circular orbit at about 622 km altitude (period about 97 min) and one elliptic orbit
+        _satellites.velocity[0] = {0.0, 7550.0, 0.0};
+        _satellites.velocity[1] = {0.0, 7800.0, 0.0};
+        _satellites.characteristicLength[0] = 0.01;
+        _satellites.characteristicLength[1] = 1.0;
+        _satellites.areaToMassRatio[0] = 0.1;
+        _satellites.areaToMassRatio[1] = 10.0;
+    }
+
+    virtual void TearDown() {
+        try {
+            std::filesystem::remove(_filePath);
+        } catch (std::exception &e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    const std::string _filePath{"resources/histogramTestFile.csv"};
+
+    Satellites _satellites{1, SatType::DEBRIS, {7000000.0, 0.0, 0.0}, 2};
+
+};
+
+/**
+ * Each fragment adds its apogee and perigee at the same period
+ */
+TEST_F(HistogramWriterTest, Gabbard) {
+    HistogramWriter writer{_filePath, HistogramType::GABBARD, {120, 500}};
+    auto histogram = writer.createHistogram(_satellites);
+
+    auto aos = _satellites.getAoS();
+    EXPECT_EQ(histogram.getCounts(), writer.createHistogram(aos).getCounts());
+    EXPECT_EQ(std::accumulate(histogram.getCounts().begin(), histogram.getCounts().end(), std::uint64_t{0}), 4);
+    EXPECT_EQ(histogram.getOutOfRange(), 0);
+
+    for (size_t i = 0; i < aos.size(); ++i) {
+        const auto elements = aos[i].getOrbitalElements();
+        const double period = util::PI2 / util::meanMotion(elements.getSemiMajorAxis()) / 60.0;
+        const double perigee =
+                (elements.getSemiMajorAxis() * (1.0 - elements.getEccentricity()) - util::EARTH_RADIUS) / 1000.0;
+        const auto x = static_cast<size_t>(period - 80.0);
+        const auto y = static_cast<size_t>(perigee / 10.0);
+        EXPECT_GE(histogram.getCount(x, y), 1);
+    }
+}
+
+TEST_F(HistogramWriterTest, AreaToMassCsv) {
+    HistogramWriter writer{_filePath, HistogramType::AM_LC, {4, 5}};
+    writer.printResult(_satellites);
+
+    std::ifstream file{_filePath};
+    std::vector<std::string> lines{};
+    for (std::string line; std::getline(file, line);) {
+        lines.push_back(line);
+    }
+
+    //Header plus two non-empty bins: log10(L_c) = -2 / log10(A/M) = -1 and log10(L_c) = 0 / log10(A/M) = 1
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(lines[0], "X lower,X upper,Y lower,Y upper,Count");
+    EXPECT_EQ(lines[1], "-2,-1,-1,0,1");
+    EXPECT_EQ(lines[2], "0,1,1,2,1");
+}
@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+
+#include "breakupModel/propagation/J2SecularPropagator.h"
+#include "breakupModel/model/OrbitalElementsColumns.h"
+#include "breakupModel/util/UtilityFunctions.h"
+#include "breakupModel/util/UtilityKepler.h"
+
+/**
+ * A sun-synchronous orbit must have a nodal precession of one revolution per year
+ */
+TEST(J2SecularPropagatorTest, SunSynchronousNodalRate) {
+    auto rates = J2SecularPropagator::secularRates(7078137.0, 0.0, util::degToRad(98.19));
+
+    const double expectedRate = util::PI2 / (365.2422 * 86400.0);
+    EXPECT_NEAR(rates[0], expectedRate, 0.01 * expectedRate);
+}
+
+/**
+ * At the critical inclination the argument of periapsis does not drift
+ */
+TEST(J2SecularPropagatorTest, CriticalInclination) {
+    auto rates = J2SecularPropagator::secularRates(26560000.0, 0.7, std::acos(std::sqrt(0.2)));
+
+    EXPECT_NEAR(rates[1], 0.0, 1e-20);
+    EXPECT_LT(rates[2], util::meanMotion(26560000.0));
+}
+
+/**
+ * Only the angles drift, the shape and orientation of the orbital plane stay the same
+ */
+TEST(J2SecularPropagatorTest, PropagateElements) {
+    OrbitalElementsColumns elements{2};
+    elements.setElement(0, {6798505.86, 0.0002215, 0.9013735469, 4.724103630312, 2.237290340, 0.5});
+    elements.setElement(1, {7200000.0, 0.01, 1.7, 0.1, 6.2, 3.0});
+
+    J2SecularPropagator propagator{};
+    const double timeStep = 30.0 * 86400.0;
+    auto result = propagator.propagate(elements, timeStep);
+
+    for (size_t i = 0; i < elements.size(); ++i) {
+        auto rates = J2SecularPropagator::secularRates(elements.semiMajorAxis[i], elements.eccentricity[i],
+                                                       elements.inclination[i]);
+        EXPECT_EQ(result.semiMajorAxis[i], elements.semiMajorAxis[i]);
+        EXPECT_EQ(result.eccentricity[i], elements.eccentricity[i]);
+        EXPECT_EQ(result.inclination[i], elements.inclination[i]);
+
+        const double expectedRAAN = std::remainder(elements.longitudeOfTheAscendingNode[i] + rates[0] * timeStep,
+                                                   util::PI2);
+        EXPECT_NEAR(std::remainder(result.longitudeOfTheAscendingNode[i] - expectedRAAN, util::PI2), 0.0, 1e-9);
+        EXPECT_GE(result.longitudeOfTheAscendingNode[i], 0.0);
+        EXPECT_LT(result.longitudeOfTheAscendingNode[i], util::PI2);
+        EXPECT_GE(result.argumentOfPeriapsis[i], 0.0);
+        EXPECT_LT(result.argumentOfPeriapsis[i], util::PI2);
+    }
+}
@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+
+#include "breakupModel/propagation/KeplerPropagator.h"
+#include "breakupModel/model/Satellites.h"
+#include "breakupModel/util/UtilityKepler.h"
+#include "breakupModel/util/UtilityFunctions.h"
+#include <array>
+#include <vector>
+#include <cmath>
+
+class KeplerPropagatorTest : public ::testing::Test {
+
+protected:
+
+    static double specificEnergy(const std::array<double, 3> &r, const std::array<double, 3> &v) {
+        const double rNorm = std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]);
+        return 0.5 * (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) - util::GRAVITATIONAL_PARAMETER_EARTH / rNorm;
+    }
+
+    static std::array<double, 3> angularMomentum(const std::array<double, 3> &r, const std::array<double, 3> &v) {
+        return {r[1] * v[2] - r[2] * v[1], r[2] * v[0] - r[0] * v[2], r[0] * v[1] - r[1] * v[0]};
+    }
+
+};
+
+/**
+ * After one orbital period every elliptic object must be back at its starting state
+ */
+TEST_F(KeplerPropagatorTest, FullPeriod) {
+    OrbitalElementsColumns elements{2};
+    elements.setElement(0, {7000000.0, 0.01, 0.9, 1.0, 2.0, 0.3});
+    elements.setElement(1, {26560000.0, 0.7, 1.1, 0.3, 4.0, 5.0});
+    const auto [startPosition, startVelocity] = elements.toCartesian();
+
+    KeplerPropagator propagator{};
+    for (size_t i = 0; i < elements.size(); ++i) {
+        const double period = util::PI2 / util::meanMotion(elements.semiMajorAxis[i]);
+        auto [position, velocity] = propagator.propagate(elements, period).toCartesian();
+        for (size_t j = 0; j < 3; ++j) {
+            EXPECT_NEAR(position[i][j], startPosition[i][j], 1e-3);
+            EXPECT_NEAR(velocity[i][j], startVelocity[i][j], 1e-6);
+        }
+    }
+}
+
+/**
+ * Energy and angular momentum are conserved for elliptic and hyperbolic fragments
+ */
+TEST_F(KeplerPropagatorTest, ConservationLaws) {
+    Satellites satellites{1, SatType::DEBRIS, {7000000.0, 0.0, 0.0}, 3};
+    satellites.velocity[0] = {0.0, 7500.0, 100.0};
+    satellites.velocity[1] = {500.0, 6000.0, 2000.0};
+    satellites.velocity[2] = {1000.0, 11000.0, 500.0};  //hyperbolic
+
+    KeplerPropagator propagator{};
+    auto snapshots = propagator.propagate(satellites, {0.0, 3600.0, 86400.0});
+
+    ASSERT_EQ(snapshots.size(), 3);
+    for (const auto &snapshot : snapshots) {
+        ASSERT_EQ(snapshot.position.size(), satellites.size());
+        for (size_t i = 0; i < satellites.size(); ++i) {
+            const double expectedEnergy = specificEnergy(satellites.position, satellites.velocity[i]);
+            const auto expectedMomentum = angularMomentum(satellites.position, satellites.velocity[i]);
+            EXPECT_NEAR(specificEnergy(snapshot.position[i], snapshot.velocity[i]), expectedEnergy,
+                        1e-6 * std::abs(expectedEnergy)) << "t=" << snapshot.time << " i=" << i;
+            const auto actualMomentum = angularMomentum(snapshot.position[i], snapshot.velocity[i]);
+            for (size_t j = 0; j < 3; ++j) {
+                EXPECT_NEAR(actualMomentum[j], expectedMomentum[j], 1e-9 * 7000000.0 * 11000.0);
+            }
+        }
+    }
+    EXPECT_NEAR(snapshots[0].position[1][0], satellites.position[0], 1e-3);
+}
+
+/**
+ * The in-place propagation activates the individual positions and matches the snapshot propagation
+ */
+TEST_F(KeplerPropagatorTest, AdvanceInPlace) {
+    Satellites satellites{1, SatType::DEBRIS, {7000000.0, 0.0, 0.0}, 2};
+    satellites.velocity[0] = {0.0, 7500.0, 100.0};
+    satellites.velocity[1] = {500.0, 6000.0, 2000.0};
+
+    KeplerPropagator propagator{};
+    auto snapshots = propagator.propagate(satellites, {3600.0});
+    propagator.advance(satellites, 3600.0);
+
+    ASSERT_TRUE(satellites.hasFragmentPositions());
+    for (size_t i = 0; i < satellites.size(); ++i) {
+        ASSERT_EQ(satellites.getPosition(i), snapshots[0].position[i]);
+        ASSERT_EQ(satellites.velocity[i], snapshots[0].velocity[i]);
+    }
+    ASSERT_NE(satellites.getPosition(0), satellites.getPosition(1));
+}
@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+
+#include "breakupModel/propagation/SGP4Propagator.h"
+#include "breakupModel/model/OrbitalElementsFactory.h"
+#include <array>
+#include <vector>
+#include <cmath>
+
+/**
+ * Verification case 00005 from "Revisiting Spacetrack Report #3" (near earth, e = 0.186)
+ */
+class SGP4PropagatorTest : public ::testing::Test {
+
+protected:
+
+    OrbitalElements _orbitalElements{OrbitalElementsFactory{}.createFromTLEData(
+            {10.82419157, 0.1859667, 34.2682, 348.7242, 331.7664, 19.3264})};
+
+    double _bstar{0.28098e-4};
+
+};
+
+TEST_F(SGP4PropagatorTest, VerificationCase00005) {
+    std::vector<std::array<double, 3>> expectedPosition{{7022465.29266,  -1400082.96755, 39.95155},
+                                                        {-7154031.20202, -3783176.82504, -3536194.12294}};
+    std::vector<std::array<double, 3>> expectedVelocity{{1893.841015, 6405.893759, 4534.807250},
+                                                        {4741.887409, -4151.817765, -2093.935425}};
+    std::vector<double> timeSteps{0.0, 360.0 * 60.0};
+
+    for (size_t i = 0; i < timeSteps.size(); ++i) {
+        auto [position, velocity] = SGP4Propagator::propagate(_orbitalElements.getAsArray(), _bstar, timeSteps[i]);
+        for (size_t j = 0; j < 3; ++j) {
+            EXPECT_NEAR(position[j], expectedPosition[i][j], 1.0) << "t=" << timeSteps[i] << " j=" << j;
+            EXPECT_NEAR(velocity[j], expectedVelocity[i][j], 1e-3) << "t=" << timeSteps[i] << " j=" << j;
+        }
+    }
+}
+
+/**
+ * The batch propagation with individual time steps yields the same results as the single propagation
+ */
+TEST_F(SGP4PropagatorTest, BatchEqualsSingle) {
+    OrbitalElementsColumns columns = OrbitalElementsColumns::fromAoS({_orbitalElements, _orbitalElements});
+    std::vector<double> bstar{_bstar, _bstar};
+    std::vector<double> timeSteps{-3600.0, 86400.0};
+
+    SGP4Propagator propagator{};
+    auto [position, velocity] = propagator.propagate(columns, bstar, timeSteps);
+
+    for (size_t i = 0; i < timeSteps.size(); ++i) {
+        auto [expectedPosition, expectedVelocity] = SGP4Propagator::propagate(_orbitalElements.getAsArray(), _bstar,
+                                                                              timeSteps[i]);
+        ASSERT_EQ(position[i], expectedPosition);
+        ASSERT_EQ(velocity[i], expectedVelocity);
+    }
+}
+
+/**
+ * Deep space objects fall back to the secular J2 propagation
+ */
+TEST_F(SGP4PropagatorTest, DeepSpaceFallback) {
+    auto geo = OrbitalElementsFactory{}.createFromTLEData({1.00272877, 0.0000694, 0.0541, 37.2659, 278.3315, 313.8654});
+
+    auto [position, velocity] = SGP4Propagator::propagate(geo.getAsArray(), 0.0, 0.0);
+    auto [expectedPosition, expectedVelocity] = util::keplerianToCartesian(geo.getAsArray());
+
+    for (size_t j = 0; j < 3; ++j) {
+        EXPECT_NEAR(position[j], expectedPosition[j], 1e-6);
+        EXPECT_NEAR(velocity[j], expectedVelocity[j], 1e-9);
+    }
+}
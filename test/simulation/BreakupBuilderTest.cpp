@@ -5,6 +5,7 @@
 #include <memory>
 #include "breakupModel/simulation/BreakupBuilder.h"
 #include "breakupModel/input/RuntimeInputSource.h"
+#include "breakupModel/model/SatelliteBuilder.h"
 
 class BreakupBuilderTest : public ::testing::Test {
 
@@ -107,3 +108,160 @@ TEST_F(BreakupBuilderTest, ConfigCollisionFilter2) {
     ASSERT_EQ(breakup->getInput(), _satellites2);
     ASSERT_EQ(breakup->getCurrentMaxGivenId(), 3);
 }
+
+TEST_F(BreakupBuilderTest, SetIDFilterAfterDataSource) {
+    const std::shared_ptr<RuntimeInputSource> config =
+            std::make_shared<RuntimeInputSource>(_expectedMinimalLength, _satellites3,
+                                                 SimulationType::COLLISION,
+                                                 std::nullopt,
+                                                 std::nullopt);
+    BreakupBuilder breakupBuilder{config};
+
+    //The filter narrows the already read satellites, unknown IDs are ignored and the input order is kept
+    breakupBuilder.setIDFilter(std::set<size_t>{3, 2, 42});
+    auto breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), _satellites4);
+    ASSERT_EQ(breakup->getCurrentMaxGivenId(), 3);
+
+    breakupBuilder.setIDFilter(std::set<size_t>{1, 2});
+    breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), _satellites2);
+}
+
+TEST_F(BreakupBuilderTest, IDFilterWithDuplicateIDs) {
+    const std::vector<Satellite> satellites{Satellite{1}, Satellite{2}, Satellite{3}, Satellite{2}};
+    const std::shared_ptr<RuntimeInputSource> config =
+            std::make_shared<RuntimeInputSource>(_expectedMinimalLength, satellites,
+                                                 SimulationType::COLLISION,
+                                                 std::nullopt,
+                                                 std::set<size_t>{2});
+    BreakupBuilder breakupBuilder{config};
+
+    //Every satellite with a filtered ID is kept, not only the first one
+    auto breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), (std::vector<Satellite>{Satellite{2}, Satellite{2}}));
+    ASSERT_EQ(breakup->getCurrentMaxGivenId(), 3);
+}
+
+TEST_F(BreakupBuilderTest, WidenPushedDownIDFilter) {
+    const std::shared_ptr<RuntimeInputSource> config =
+            std::make_shared<RuntimeInputSource>(_expectedMinimalLength, _satellites3,
+                                                 SimulationType::COLLISION,
+                                                 std::nullopt,
+                                                 std::set<size_t>{2, 3});
+    BreakupBuilder breakupBuilder{config};
+    auto breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), _satellites4);
+    ASSERT_EQ(breakup->getCurrentMaxGivenId(), 3);
+
+    //The filter was pushed down into the DataSource, an ID outside of it requires to read the DataSource again
+    breakupBuilder.setIDFilter(std::set<size_t>{1, 2});
+    breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), _satellites2);
+    ASSERT_EQ(breakup->getCurrentMaxGivenId(), 3);
+}
+
+TEST_F(BreakupBuilderTest, FindIDsInRegime) {
+    SatelliteBuilder satelliteBuilder{};
+    const std::vector<Satellite> satellites{
+            satelliteBuilder.reset().setID(1).setSatType(SatType::ROCKET_BODY).setMass(100.0)
+                    .setOrbitalElements(OrbitalElements{util::EARTH_RADIUS + 800.0e3, 0.0, util::degToRad(98.5),
+                                                        0.0, 0.0, 0.0}).getResult(),
+            satelliteBuilder.reset().setID(2).setSatType(SatType::ROCKET_BODY).setMass(100.0)
+                    .setOrbitalElements(OrbitalElements{util::EARTH_RADIUS + 400.0e3, 0.0, util::degToRad(51.6),
+                                                        0.0, 0.0, 0.0}).getResult(),
+            satelliteBuilder.reset().setID(3).setSatType(SatType::SPACECRAFT).setMass(100.0)
+                    .setOrbitalElements(OrbitalElements{util::EARTH_RADIUS + 850.0e3, 0.0, util::degToRad(98.7),
+                                                        0.0, 0.0, 0.0}).getResult()
+    };
+    const std::shared_ptr<RuntimeInputSource> config =
+            std::make_shared<RuntimeInputSource>(_expectedMinimalLength, satellites,
+                                                 SimulationType::EXPLOSION,
+                                                 std::nullopt,
+                                                 std::nullopt);
+    BreakupBuilder breakupBuilder{config};
+
+    OrbitalRegimeQuery query{};
+    query.minimalPerigeeAltitude = 700.0e3;
+    query.maximalPerigeeAltitude = 900.0e3;
+    query.minimalInclination = util::degToRad(98.0);
+    query.maximalInclination = util::degToRad(99.0);
+    ASSERT_EQ(breakupBuilder.findIDsInRegime(query), (std::set<size_t>{1, 3}));
+
+    query.satType = SatType::ROCKET_BODY;
+    breakupBuilder.setIDFilter(breakupBuilder.findIDsInRegime(query));
+    auto breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), std::vector<Satellite>{Satellite{1}});
+}
+
+TEST_F(BreakupBuilderTest, FindIDsInRegimeWithIDFilter) {
+    SatelliteBuilder satelliteBuilder{};
+    const std::vector<Satellite> satellites{
+            satelliteBuilder.reset().setID(1).setSatType(SatType::ROCKET_BODY).setMass(100.0)
+                    .setOrbitalElements(OrbitalElements{util::EARTH_RADIUS + 800.0e3, 0.0, util::degToRad(98.5),
+                                                        0.0, 0.0, 0.0}).getResult(),
+            satelliteBuilder.reset().setID(2).setSatType(SatType::ROCKET_BODY).setMass(100.0)
+                    .setOrbitalElements(OrbitalElements{util::EARTH_RADIUS + 400.0e3, 0.0, util::degToRad(51.6),
+                                                        0.0, 0.0, 0.0}).getResult(),
+            satelliteBuilder.reset().setID(3).setSatType(SatType::SPACECRAFT).setMass(100.0)
+                    .setOrbitalElements(OrbitalElements{util::EARTH_RADIUS + 850.0e3, 0.0, util::degToRad(98.7),
+                                                        0.0, 0.0, 0.0}).getResult()
+    };
+    const std::shared_ptr<RuntimeInputSource> config =
+            std::make_shared<RuntimeInputSource>(_expectedMinimalLength, satellites,
+                                                 SimulationType::COLLISION,
+                                                 std::nullopt,
+                                                 std::set<size_t>{2});
+    BreakupBuilder breakupBuilder{config};
+
+    //The configured filter was pushed down, but the query still covers the whole Data Source
+    OrbitalRegimeQuery query{};
+    query.minimalInclination = util::degToRad(98.0);
+    query.maximalInclination = util::degToRad(99.0);
+    const auto ids = breakupBuilder.findIDsInRegime(query);
+    ASSERT_EQ(ids, (std::set<size_t>{1, 3}));
+
+    breakupBuilder.setIDFilter(ids);
+    auto breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), (std::vector<Satellite>{Satellite{1}, Satellite{3}}));
+}
+
+namespace {
+
+/**
+ * DataSource which counts how often it is streamed
+ */
+class CountingSource : public DataSource {
+
+    std::vector<Satellite> _satellites;
+
+public:
+
+    mutable size_t passes{0};
+
+    explicit CountingSource(std::vector<Satellite> satellites) : _satellites{std::move(satellites)} {}
+
+    void forEachSatelliteBatch(size_t, const SatelliteBatchVisitor &visitor) const override {
+        ++passes;
+        auto batch = _satellites;
+        visitor(batch);
+    }
+
+};
+
+}
+
+TEST_F(BreakupBuilderTest, PushedDownFilterReadsSourceOnce) {
+    const std::shared_ptr<RuntimeInputSource> config =
+            std::make_shared<RuntimeInputSource>(_expectedMinimalLength, _satellites1);
+    BreakupBuilder breakupBuilder{config};
+    const auto source = std::make_shared<CountingSource>(_satellites3);
+
+    //The filtered satellites and the maximal ID of the whole source are determined in one pass
+    breakupBuilder.setIDFilter(std::set<size_t>{1, 2}).setDataSource(source);
+    ASSERT_EQ(source->passes, 1);
+
+    auto breakup = breakupBuilder.getBreakup();
+    ASSERT_EQ(breakup->getInput(), _satellites2);
+    ASSERT_EQ(breakup->getCurrentMaxGivenId(), 3);
+}
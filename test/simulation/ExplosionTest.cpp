@@ -102,4 +102,51 @@ TEST_F(ExplosionTest, CheckNoRaceCondition) {
            "It could also be just a random coincidence of the RNG\n"
            "Rerun this in such a case!\n";
     }
-}
\ No newline at end of file
+}
+
+/**
+ * The culling removes exactly the fragments with a low perigee or a hyperbolic trajectory and records them
+ */
+TEST_F(ExplosionTest, CullingTest) {
+    const double radius = util::EARTH_RADIUS + 300000.0;
+    const double speed = std::sqrt(util::GRAVITATIONAL_PARAMETER_EARTH / radius);
+    _input[0].setPosition({radius, 0.0, 0.0});
+    _input[0].setVelocity({0.0, speed, 0.0});
+    const double cullingAltitude = 250000.0;
+
+    Explosion reference{_input, _minimalCharacteristicLength};
+    reference.setSeed(std::make_optional(1234)).run();
+    auto unculled = reference.getResult();
+
+    Explosion explosion{_input, _minimalCharacteristicLength};
+    explosion.setSeed(std::make_optional(1234)).setCullingAltitude(cullingAltitude).run();
+    auto culled = explosion.getResult();
+    const auto &statistics = explosion.getCullingStatistics();
+
+    size_t expectedReentry = 0;
+    for (const auto &sat : unculled) {
+        auto elements = sat.getOrbitalElements();
+        const double perigee = elements.getSemiMajorAxis() * (1.0 - elements.getEccentricity());
+        if (elements.getEccentricity() < 1.0 && perigee < util::EARTH_RADIUS + cullingAltitude) {
+            ++expectedReentry;
+        }
+    }
+    ASSERT_GT(statistics.reentryCount, 0);
+    ASSERT_EQ(statistics.reentryCount, expectedReentry);
+    ASSERT_EQ(culled.size() + statistics.reentryCount + statistics.escapeCount, unculled.size());
+
+    double culledMass = 0.0;
+    for (const auto &sat : culled) {
+        culledMass += sat.getMass();
+        auto elements = sat.getOrbitalElements();
+        ASSERT_LT(elements.getEccentricity(), 1.0);
+        ASSERT_GE(elements.getSemiMajorAxis() * (1.0 - elements.getEccentricity()),
+                  util::EARTH_RADIUS + cullingAltitude - 1e-3);
+    }
+    double unculledMass = 0.0;
+    for (const auto &sat : unculled) {
+        unculledMass += sat.getMass();
+    }
+    ASSERT_NEAR(culledMass + statistics.reentryMass + statistics.escapeMass, unculledMass, 1e-6 * unculledMass);
+    ASSERT_EQ(reference.getCullingStatistics().reentryCount, 0);
+}
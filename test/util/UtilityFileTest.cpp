@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include "breakupModel/util/UtilityFile.h"
+
+/**
+ * The mapped file must contain exactly the bytes of the file
+ */
+TEST(UtilityFileTest, MappedFileView) {
+    const std::string path = (std::filesystem::temp_directory_path() / "UtilityFileTestMapped.txt").string();
+    const std::string content{"1 first\n2 second\n1 third\n2 fourth\n"};
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << content;
+    }
+    {
+        util::MappedFile mappedFile{path};
+        ASSERT_EQ(mappedFile.view(), content);
+    }
+    std::filesystem::remove(path);
+
+    ASSERT_THROW(util::MappedFile{"DoesNotExist.txt"}, std::runtime_error);
+}
+
+/**
+ * The chunks must cover the whole text and only start at record boundaries
+ */
+TEST(UtilityFileTest, SplitIntoChunks) {
+    std::string text{};
+    for (size_t i = 0; i < 100; ++i) {
+        text.append("1 line one of record ").append(std::to_string(i)).append("\n2 line two\n");
+    }
+    auto isRecordStart = [](std::string_view line) { return !line.empty() && line.front() == '1'; };
+    for (size_t chunkCount : {1, 3, 7, 64, 500}) {
+        const auto chunks = util::splitIntoChunks(text, chunkCount, isRecordStart);
+        ASSERT_LE(chunks.size(), chunkCount);
+        std::string concatenated{};
+        for (const auto &chunk : chunks) {
+            ASSERT_EQ(chunk.front(), '1');
+            concatenated.append(chunk);
+        }
+        ASSERT_EQ(concatenated, text);
+    }
+}
+
+/**
+ * The blocks of a compressed file must cover the whole text and only end in front of record starts,
+ * an uncompressed file is passed as one block
+ */
+TEST(UtilityFileTest, ForEachTextBlock) {
+    std::string text{};
+    for (size_t i = 0; i < 1000; ++i) {
+        text.append("1 line one of record ").append(std::to_string(i)).append("\n2 line two\n");
+    }
+    auto isRecordStart = [](std::string_view line) { return !line.empty() && line.front() == '1'; };
+    const auto directory = std::filesystem::temp_directory_path();
+    const std::string path = (directory / "UtilityFileTestBlocks.txt").string();
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << text;
+    }
+    size_t blocks = 0;
+    util::forEachTextBlock(path, isRecordStart, [&](std::string_view block) {
+        ++blocks;
+        EXPECT_EQ(block, text);
+        return true;
+    });
+    ASSERT_EQ(blocks, 1);
+    std::filesystem::remove(path);
+
+#ifdef BREAKUP_MODEL_ZLIB
+    //Two concatenated gzip members
+    const std::string gzipPath = (directory / "UtilityFileTestBlocks.txt.gz").string();
+    const std::string truncatedPath = (directory / "UtilityFileTestBlocks.truncated.gz").string();
+    const size_t half = text.find("1 line one of record 500");
+    bool firstMember = true;
+    for (const auto &member : {text.substr(0, half), text.substr(half)}) {
+        gzFile file = gzopen(gzipPath.c_str(), firstMember ? "wb" : "ab");
+        firstMember = false;
+        gzwrite(file, member.data(), static_cast<unsigned>(member.size()));
+        gzclose(file);
+    }
+    std::string concatenated{};
+    util::forEachTextBlock(gzipPath, isRecordStart, [&](std::string_view block) {
+        EXPECT_EQ(block.front(), '1');
+        EXPECT_EQ(block.back(), '\n');
+        concatenated.append(block);
+        return true;
+    }, 1000);
+    ASSERT_EQ(concatenated, text);
+
+    //The consumer can stop early
+    size_t consumed = 0;
+    util::forEachTextBlock(gzipPath, isRecordStart, [&](std::string_view) {
+        return ++consumed < 2;
+    }, 1000);
+    ASSERT_EQ(consumed, 2);
+
+    //Truncated data
+    {
+        const util::MappedFile compressed{gzipPath};
+        std::ofstream file{truncatedPath, std::ios::binary};
+        file << compressed.view().substr(0, compressed.view().size() / 2);
+    }
+    ASSERT_THROW(util::forEachTextBlock(truncatedPath, isRecordStart,
+                                        [](std::string_view) { return true; }), std::runtime_error);
+    std::filesystem::remove(gzipPath);
+    std::filesystem::remove(truncatedPath);
+#endif
+}
+
+TEST(UtilityFileTest, ParseNumber) {
+    ASSERT_EQ(util::parseNumber<double>(" 51.6416"), 51.6416);
+    ASSERT_EQ(util::parseNumber<double>("+0.0006703"), std::stod("0.0006703"));
+    ASSERT_EQ(util::parseNumber<int>("-4"), -4);
+    ASSERT_EQ(util::parseNumber<size_t>("5544 "), 5544);
+    ASSERT_THROW(util::parseNumber<double>("   "), std::runtime_error);
+    ASSERT_THROW(util::parseNumber<int>("abc"), std::runtime_error);
+}
@@ -0,0 +1,33 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+#include "breakupModel/util/UtilityHashIndex.h"
+
+/**
+ * The index must find every inserted key after several rehashes and keep the first value of duplicates
+ */
+TEST(UtilityHashIndexTest, InsertFind) {
+    util::IdIndex index{};
+    for (size_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(index.insert(i * 7, i));
+    }
+    ASSERT_FALSE(index.insert(7, 42));
+    ASSERT_EQ(index.size(), 10000);
+
+    for (size_t i = 0; i < 10000; ++i) {
+        ASSERT_EQ(index.find(i * 7), i) << "i=" << i;
+    }
+    ASSERT_EQ(index.find(1), util::IdIndex::NOT_FOUND);
+    ASSERT_FALSE(index.contains(SIZE_MAX));
+    ASSERT_THROW(index.insert(SIZE_MAX, 0), std::runtime_error);
+}
+
+TEST(UtilityHashIndexTest, BuildFirstOccurrence) {
+    const std::vector<size_t> ids{5, 3, 5, 1, 3};
+    const auto index = util::IdIndex::build(ids.size(), [&](size_t i) { return ids[i]; });
+
+    ASSERT_EQ(index.size(), 3);
+    ASSERT_EQ(index.find(5), 0);
+    ASSERT_EQ(index.find(3), 1);
+    ASSERT_EQ(index.find(1), 3);
+}
@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include "breakupModel/util/UtilityHistogram.h"
+#include "breakupModel/util/UtilityNpy.h"
+
+TEST(UtilityHistogramTest, AddAndOutOfRange) {
+    util::Histogram2D histogram{{0.0, 10.0}, {0.0, 1.0}, 5, 2};
+
+    histogram.add(0.0, 0.0);
+    histogram.add(9.99, 0.99);
+    histogram.add(3.0, 0.6);
+    histogram.add(10.0, 0.5);
+    histogram.add(-1.0, 0.5);
+    histogram.add(std::nan(""), 0.5);
+
+    EXPECT_EQ(histogram.getCount(0, 0), 1);
+    EXPECT_EQ(histogram.getCount(4, 1), 1);
+    EXPECT_EQ(histogram.getCount(1, 1), 1);
+    EXPECT_EQ(histogram.getOutOfRange(), 3);
+    EXPECT_THROW((util::Histogram2D{{1.0, 1.0}, {0.0, 1.0}, 1, 1}), std::runtime_error);
+}
+
+/**
+ * The parallel build with local histograms must count exactly like adding all values serially
+ */
+TEST(UtilityHistogramTest, BuildEqualsSerial) {
+    const util::Histogram2D prototype{{0.0, 1.0}, {0.0, 1.0}, 7, 3};
+    const size_t size = 10000;
+    auto valueX = [](size_t i) { return static_cast<double>(i % 113) / 100.0; };
+    auto valueY = [](size_t i) { return static_cast<double>(i % 37) / 30.0; };
+
+    util::Histogram2D serial{prototype};
+    for (size_t i = 0; i < size; ++i) {
+        serial.add(valueX(i), valueY(i));
+    }
+    auto parallel = util::Histogram2D::build(prototype, size, [&](size_t i, util::Histogram2D &local) {
+        local.add(valueX(i), valueY(i));
+    });
+
+    EXPECT_EQ(parallel.getCounts(), serial.getCounts());
+    EXPECT_EQ(parallel.getOutOfRange(), serial.getOutOfRange());
+}
+
+/**
+ * The header of the NPY format is padded to 64 bytes and followed by the raw data
+ */
+TEST(UtilityHistogramTest, NpyFormat) {
+    const std::uint64_t data[6]{1, 2, 3, 4, 5, 6};
+    std::ostringstream stream{};
+    util::writeNpy(stream, data, {2, 3});
+    const std::string npy = stream.str();
+
+    const size_t headerSize = npy.size() - sizeof(data);
+    EXPECT_EQ(headerSize % 64, 0);
+    EXPECT_EQ(npy.substr(0, 6), "\x93NUMPY");
+    EXPECT_EQ(static_cast<unsigned char>(npy[8]) + 256 * static_cast<unsigned char>(npy[9]), headerSize - 10);
+    EXPECT_NE(npy.find("{'descr': '<u8', 'fortran_order': False, 'shape': (2, 3), }"), std::string::npos);
+    EXPECT_EQ(npy[headerSize - 1], '\n');
+    EXPECT_EQ(*reinterpret_cast<const std::uint64_t *>(npy.data() + headerSize + 5 * sizeof(std::uint64_t)), 6);
+}
@@ -2,6 +2,8 @@
 
 #include <utility>
 #include <vector>
+#include <array>
+#include <cmath>
 #include "breakupModel/util/UtilityFunctions.h"
 #include "breakupModel/util/UtilityKepler.h"
 
@@ -95,3 +97,69 @@ TEST_P(UtilityKeplerTest02, meanMotionToSemiMajorAxisConversion) {
 
 INSTANTIATE_TEST_SUITE_P(DoubleParam, UtilityKeplerTest02,
                          ::testing::ValuesIn(meanMotionValues()));
+
+class UtilityKeplerTest03 : public ::testing::TestWithParam<double> {
+
+};
+
+/**
+ * The Kepler equation solver must converge for the whole elliptic range with its fixed number of steps
+ */
+TEST_P(UtilityKeplerTest03, meanAnomalyToEccentricAnomalyEccentricities) {
+    using namespace util;
+    double eccentricity = GetParam();
+
+    for (double expectedMeanAnomaly : radValues()) {
+        double eccentricAnomaly = meanAnomalyToEccentricAnomaly(expectedMeanAnomaly, eccentricity);
+
+        double actualMeanAnomaly = eccentricAnomalyToMeanAnomaly(eccentricAnomaly, eccentricity);
+
+        ASSERT_NEAR(actualMeanAnomaly, expectedMeanAnomaly, 1e-14) << "e=" << eccentricity;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(DoubleParam, UtilityKeplerTest03,
+                         ::testing::Values(0.0, 0.0001, 0.1, 0.5, 0.8, 0.95, 0.99, 0.999));
+
+/**
+ * The batch conversion yields the same results as the single conversion
+ */
+TEST(UtilityKeplerTest04, meanAnomalyToEccentricAnomalyBatch) {
+    using namespace util;
+    std::vector<double> anomaly = radValues();
+    std::vector<double> eccentricity(anomaly.size(), 0.7);
+    std::vector<double> expected{};
+    for (double meanAnomaly : anomaly) {
+        expected.push_back(meanAnomalyToEccentricAnomaly(meanAnomaly, 0.7));
+    }
+
+    meanAnomalyToEccentricAnomaly(anomaly, eccentricity);
+
+    ASSERT_EQ(anomaly, expected);
+}
+
+/**
+ * The hyperbolic velocity equals the finite difference of the positions over time. The time along the orbit follows
+ * from the hyperbolic Kepler equation M = e sinh(H) - H with the hyperbolic anomaly H = ln(tan(gd / 2 + pi / 4)).
+ */
+TEST(UtilityKeplerTest05, keplerianToCartesianHyperbolicVelocity) {
+    using namespace util;
+    const double a = 20000000.0;
+    const double e = 1.5;
+    const double gudermannian = 0.4;
+    const double step = 1e-6;
+    auto timeOf = [&](double gd) {
+        const double hyperbolicAnomaly = std::log(std::tan(0.5 * gd + 0.25 * PI));
+        return (e * std::sinh(hyperbolicAnomaly) - hyperbolicAnomaly) /
+               std::sqrt(GRAVITATIONAL_PARAMETER_EARTH / (a * a * a));
+    };
+
+    const auto [position, velocity] = keplerianToCartesian({a, e, 0.5, 1.0, 2.0, gudermannian});
+    const auto before = keplerianToCartesian({a, e, 0.5, 1.0, 2.0, gudermannian - step}).first;
+    const auto after = keplerianToCartesian({a, e, 0.5, 1.0, 2.0, gudermannian + step}).first;
+    const double timeStep = timeOf(gudermannian + step) - timeOf(gudermannian - step);
+
+    for (size_t j = 0; j < 3; ++j) {
+        EXPECT_NEAR(velocity[j], (after[j] - before[j]) / timeStep, 1e-3) << "j = " << j;
+    }
+}
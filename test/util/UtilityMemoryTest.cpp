@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstdint>
+#include "breakupModel/util/UtilityMemory.h"
+#include "breakupModel/model/Satellites.h"
+
+/**
+ * The columns must be aligned to (at least) a cache line
+ */
+TEST(UtilityMemoryTest, ColumnAlignment) {
+    util::ColumnVector<double> column(1000);
+    auto address = reinterpret_cast<std::uintptr_t>(column.data());
+    ASSERT_EQ(address % util::CACHE_LINE_SIZE, 0);
+}
+
+/**
+ * Resizing the SoA must still zero-initialize all new elements (small and parallel first-touch path)
+ */
+TEST(UtilityMemoryTest, SatellitesResizeZeroInitialized) {
+    const std::array<double, 3> zeroArray{{0.0, 0.0, 0.0}};
+    Satellites satellites{1, SatType::DEBRIS, {1.0, 2.0, 3.0}, 10};
+    satellites.mass[9] = 5.0;
+    satellites.resize(util::FIRST_TOUCH_PARALLEL_THRESHOLD * 2);
+
+    ASSERT_EQ(satellites.size(), util::FIRST_TOUCH_PARALLEL_THRESHOLD * 2);
+    ASSERT_EQ(satellites.mass[9], 5.0);
+    for (size_t i = 10; i < satellites.size(); ++i) {
+        ASSERT_EQ(satellites.characteristicLength[i], 0.0) << "i=" << i;
+        ASSERT_EQ(satellites.areaToMassRatio[i], 0.0) << "i=" << i;
+        ASSERT_EQ(satellites.mass[i], 0.0) << "i=" << i;
+        ASSERT_EQ(satellites.area[i], 0.0) << "i=" << i;
+        ASSERT_EQ(satellites.velocity[i], zeroArray) << "i=" << i;
+        ASSERT_EQ(satellites.ejectionVelocity[i], zeroArray) << "i=" << i;
+        ASSERT_EQ(satellites.name[i], nullptr) << "i=" << i;
+    }
+}